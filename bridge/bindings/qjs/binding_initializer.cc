@@ -19,6 +19,7 @@
 #include "qjs_custom_event.h"
 #include "qjs_document.h"
 #include "qjs_document_fragment.h"
+#include "qjs_dom_token_list.h"
 #include "qjs_element.h"
 #include "qjs_element_attributes.h"
 #include "qjs_error_event.h"
@@ -31,6 +32,7 @@
 #include "qjs_html_body_element.h"
 #include "qjs_html_button_element.h"
 #include "qjs_html_canvas_element.h"
+#include "qjs_html_collection.h"
 #include "qjs_html_div_element.h"
 #include "qjs_html_element.h"
 #include "qjs_html_form_element.h"
@@ -60,6 +62,7 @@
 #include "qjs_pointer_event.h"
 #include "qjs_pop_state_event.h"
 #include "qjs_promise_rejection_event.h"
+#include "qjs_property_batch_reader.h"
 #include "qjs_screen.h"
 #include "qjs_text.h"
 #include "qjs_touch.h"
@@ -74,12 +77,13 @@
 namespace webf {
 
 void InstallBindings(ExecutingContext* context) {
-  // Must follow the inheritance order when install.
-  // Exp: Node extends EventTarget, EventTarget must be install first.
+  // Defines the global functions and the constructor accessors only. The constructor and the prototype of a class are
+  // created with the ones of its parent classes on first use, e.g. Node and EventTarget for the first Text node.
   QJSWindowOrWorkerGlobalScope::Install(context);
   QJSLocation::Install(context);
   QJSModuleManager::Install(context);
   QJSConsole::Install(context);
+  QJSPropertyBatchReader::Install(context);
   QJSEventTarget::Install(context);
   QJSWindow::Install(context);
   QJSEvent::Install(context);
@@ -102,6 +106,7 @@ void InstallBindings(ExecutingContext* context) {
   QJSKeyboardEvent::Install(context);
   QJSNode::Install(context);
   QJSNodeList::Install(context);
+  QJSDOMTokenList::Install(context);
   QJSDocument::Install(context);
   QJSDocumentFragment::Install(context);
   QJSCharacterData::Install(context);
@@ -131,6 +136,7 @@ void InstallBindings(ExecutingContext* context) {
   QJSCSSStyleDeclaration::Install(context);
   QJSBoundingClientRect::Install(context);
   QJSHTMLAllCollection::Install(context);
+  QJSHTMLCollection::Install(context);
   QJSScreen::Install(context);
   QJSBlob::Install(context);
   QJSTouch::Install(context);
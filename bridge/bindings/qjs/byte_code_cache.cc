@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "byte_code_cache.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#ifndef QUICKJS_VERSION
+#define QUICKJS_VERSION "unknown"
+#endif
+
+#ifndef APP_REV
+#define APP_REV "unknown"
+#endif
+
+namespace webf {
+
+// Compiling short scripts costs less than opening a file.
+static const size_t kMinimumByteCodeCacheSourceLength = 4 * 1024;
+
+// Bytecode is only readable by the engine which wrote it, and the bridge patches the engine, so entries of other
+// builds are rejected too.
+static const char kByteCodeCacheEngineVersion[] = QUICKJS_VERSION "/" APP_REV;
+static const char kByteCodeCacheMagic[] = {'W', 'F', 'B', 'C'};
+static const uint32_t kByteCodeCacheFormatVersion = 1;
+
+struct ByteCodeCacheHeader {
+  char magic[sizeof(kByteCodeCacheMagic)];
+  uint32_t format_version;
+  char engine_version[64];
+  uint64_t source_hash;
+  uint64_t source_length;
+  uint64_t byte_code_length;
+  uint64_t byte_code_checksum;
+};
+
+static_assert(sizeof(kByteCodeCacheEngineVersion) <= sizeof(ByteCodeCacheHeader::engine_version),
+              "The engine version doesn't fit in the header.");
+
+static std::mutex byte_code_cache_directory_mutex;
+static std::string byte_code_cache_directory;
+static std::atomic<uint32_t> temporary_file_id{0};
+
+// 64-bit FNV-1a.
+static uint64_t Hash(const void* data, size_t length, uint64_t hash = 0xcbf29ce484222325) {
+  auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3;
+  }
+  return hash;
+}
+
+static ByteCodeCacheHeader CreateHeader(uint64_t source_hash, uint64_t source_length) {
+  ByteCodeCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kByteCodeCacheMagic, sizeof(kByteCodeCacheMagic));
+  header.format_version = kByteCodeCacheFormatVersion;
+  memcpy(header.engine_version, kByteCodeCacheEngineVersion, sizeof(kByteCodeCacheEngineVersion));
+  header.source_hash = source_hash;
+  header.source_length = source_length;
+  return header;
+}
+
+static bool WriteAll(int fd, const void* data, size_t length) {
+  auto* bytes = static_cast<const uint8_t*>(data);
+  while (length > 0) {
+    ssize_t written = write(fd, bytes, length);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    bytes += written;
+    length -= written;
+  }
+  return true;
+}
+
+CachedByteCode::CachedByteCode(void* mapping, size_t mapping_length, const uint8_t* bytes, size_t length)
+    : mapping_(mapping), mapping_length_(mapping_length), bytes_(bytes), length_(length) {}
+
+CachedByteCode::~CachedByteCode() {
+  munmap(mapping_, mapping_length_);
+}
+
+void ByteCodeCache::SetDirectory(const std::string& directory) {
+  std::lock_guard<std::mutex> lock(byte_code_cache_directory_mutex);
+  byte_code_cache_directory = directory;
+}
+
+std::unique_ptr<ByteCodeCache> ByteCodeCache::ForScript(const char* code, size_t length, const char* source_url) {
+  if (length < kMinimumByteCodeCacheSourceLength)
+    return nullptr;
+
+  std::string cache_directory;
+  {
+    std::lock_guard<std::mutex> lock(byte_code_cache_directory_mutex);
+    cache_directory = byte_code_cache_directory;
+  }
+  if (cache_directory.empty())
+    return nullptr;
+
+  uint64_t hash = Hash(kByteCodeCacheEngineVersion, sizeof(kByteCodeCacheEngineVersion));
+  // Keep the terminating null, so that the url and the source can't be shifted into each other.
+  hash = Hash(source_url, strlen(source_url) + 1, hash);
+  hash = Hash(code, length, hash);
+  return std::unique_ptr<ByteCodeCache>(new ByteCodeCache(std::move(cache_directory), hash, length));
+}
+
+ByteCodeCache::ByteCodeCache(std::string directory, uint64_t source_hash, uint64_t source_length)
+    : directory_(std::move(directory)), source_hash_(source_hash), source_length_(source_length) {
+  char name[32];
+  snprintf(name, sizeof(name), "/%016" PRIx64 ".qjsc", source_hash);
+  path_ = directory_ + name;
+}
+
+std::unique_ptr<CachedByteCode> ByteCodeCache::Load(bool* rejected) const {
+  *rejected = false;
+  int fd = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) <= sizeof(ByteCodeCacheHeader)) {
+    close(fd);
+    *rejected = true;
+    return nullptr;
+  }
+  auto mapping_length = static_cast<size_t>(st.st_size);
+  void* mapping = mmap(nullptr, mapping_length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED)
+    return nullptr;
+
+  ByteCodeCacheHeader expected = CreateHeader(source_hash_, source_length_);
+  ByteCodeCacheHeader header;
+  memcpy(&header, mapping, sizeof(header));
+  auto* bytes = static_cast<const uint8_t*>(mapping) + sizeof(header);
+  size_t length = mapping_length - sizeof(header);
+
+  if (memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 ||
+      header.format_version != expected.format_version ||
+      memcmp(header.engine_version, expected.engine_version, sizeof(header.engine_version)) != 0 ||
+      header.source_hash != expected.source_hash || header.source_length != expected.source_length ||
+      header.byte_code_length != length || header.byte_code_checksum != Hash(bytes, length)) {
+    munmap(mapping, mapping_length);
+    *rejected = true;
+    return nullptr;
+  }
+
+  return std::make_unique<CachedByteCode>(mapping, mapping_length, bytes, length);
+}
+
+bool ByteCodeCache::Store(const uint8_t* bytes, size_t length) const {
+  if (mkdir(directory_.c_str(), 0700) != 0 && errno != EEXIST)
+    return false;
+
+  ByteCodeCacheHeader header = CreateHeader(source_hash_, source_length_);
+  header.byte_code_length = length;
+  header.byte_code_checksum = Hash(bytes, length);
+
+  // Pages of other threads may store the same entry at the same time, each one writes its own temporary file.
+  std::string temporary_path =
+      path_ + "." + std::to_string(getpid()) + "." + std::to_string(temporary_file_id++) + ".tmp";
+  int fd = open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (fd < 0)
+    return false;
+
+  bool success = WriteAll(fd, &header, sizeof(header)) && WriteAll(fd, bytes, length);
+  success = close(fd) == 0 && success;
+  if (!success || rename(temporary_path.c_str(), path_.c_str()) != 0) {
+    unlink(temporary_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace webf
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_BINDINGS_QJS_BYTE_CODE_CACHE_H_
+#define BRIDGE_BINDINGS_QJS_BYTE_CODE_CACHE_H_
+
+#include <cinttypes>
+#include <memory>
+#include <string>
+#include "foundation/macros.h"
+
+namespace webf {
+
+struct ByteCodeCacheStats {
+  // Scripts evaluated from cached bytecode.
+  int64_t hits{0};
+  // Scripts compiled from the source, their bytecode is stored for the next evaluation.
+  int64_t misses{0};
+  // Entries found but not used, e.g. written by another engine version or truncated.
+  int64_t rejects{0};
+};
+
+// The bytecode of a cache entry, mapped in memory until destruction.
+class CachedByteCode {
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(CachedByteCode);
+
+ public:
+  CachedByteCode(void* mapping, size_t mapping_length, const uint8_t* bytes, size_t length);
+  ~CachedByteCode();
+
+  const uint8_t* bytes() const { return bytes_; }
+  size_t length() const { return length_; }
+
+ private:
+  void* mapping_;
+  size_t mapping_length_;
+  const uint8_t* bytes_;
+  size_t length_;
+};
+
+// Compiled bytecode of evaluated scripts, stored as one file per script in a local directory.
+//
+// An entry is addressed by a hash of the engine version, the source url, which is compiled into the bytecode for
+// stack traces, and the source. The header of the entry records them again together with a checksum of the bytecode,
+// so entries of another engine, colliding names or partially written files are rejected instead of being evaluated.
+// Entries are written to a temporary file and renamed, readers never see a file being written.
+class ByteCodeCache {
+ public:
+  // Process wide, an empty directory disables the cache. The directory is created on the first store.
+  static void SetDirectory(const std::string& directory);
+
+  // Returns nullptr when the cache is disabled, or the script is too short to be worth caching.
+  static std::unique_ptr<ByteCodeCache> ForScript(const char* code, size_t length, const char* source_url);
+
+  // Returns nullptr when there is no usable entry, |rejected| is set when an invalid entry was found.
+  std::unique_ptr<CachedByteCode> Load(bool* rejected) const;
+  bool Store(const uint8_t* bytes, size_t length) const;
+
+ private:
+  ByteCodeCache(std::string directory, uint64_t source_hash, uint64_t source_length);
+
+  std::string directory_;
+  std::string path_;
+  uint64_t source_hash_;
+  uint64_t source_length_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_BINDINGS_QJS_BYTE_CODE_CACHE_H_
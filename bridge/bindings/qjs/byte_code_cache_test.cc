@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "byte_code_cache.h"
+#include <dirent.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+namespace {
+
+std::string CreateCacheDirectory() {
+  char path[] = "/tmp/webf_byte_code_cache_XXXXXX";
+  EXPECT_NE(mkdtemp(path), nullptr);
+  return path;
+}
+
+std::vector<std::string> ListEntries(const std::string& directory) {
+  std::vector<std::string> entries;
+  DIR* dir = opendir(directory.c_str());
+  while (dirent* entry = readdir(dir)) {
+    if (entry->d_name[0] != '.')
+      entries.emplace_back(directory + "/" + entry->d_name);
+  }
+  closedir(dir);
+  return entries;
+}
+
+void RemoveCacheDirectory(const std::string& directory) {
+  for (auto& entry : ListEntries(directory)) {
+    unlink(entry.c_str());
+  }
+  rmdir(directory.c_str());
+}
+
+void FlipByte(const std::string& path, std::streamoff offset, std::ios_base::seekdir from) {
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekg(offset, from);
+  char c = static_cast<char>(file.peek() ^ 0xff);
+  file.seekp(offset, from);
+  file.put(c);
+}
+
+// Long enough to be cached.
+std::string LongScript() {
+  std::string code = "var total = 0;";
+  for (int i = 0; i < 500; i++) {
+    code += "total += 1;";
+  }
+  code += "console.log(total);";
+  return code;
+}
+
+}  // namespace
+
+TEST(ByteCodeCache, evaluateLongScriptsFromCachedByteCode) {
+  static int logCount = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCount++;
+    EXPECT_STREQ(message.c_str(), "500");
+  };
+  std::string directory = CreateCacheDirectory();
+  ByteCodeCache::SetDirectory(directory);
+  std::string code = LongScript();
+
+  {
+    auto bridge = TEST_init();
+    bridge->evaluateScript(code.c_str(), code.size(), "vm://", 0);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().misses, 1);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().hits, 0);
+  }
+  EXPECT_EQ(ListEntries(directory).size(), 1);
+
+  {
+    auto bridge = TEST_init();
+    bridge->evaluateScript(code.c_str(), code.size(), "vm://", 0);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().misses, 0);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().hits, 1);
+
+    // Short scripts are compiled every time.
+    const char* short_code = "console.log(500);";
+    bridge->evaluateScript(short_code, strlen(short_code), "vm://", 0);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().misses, 0);
+  }
+
+  ByteCodeCache::SetDirectory("");
+  RemoveCacheDirectory(directory);
+  EXPECT_EQ(logCount, 3);
+}
+
+TEST(ByteCodeCache, rejectInvalidEntries) {
+  static int logCount = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCount++;
+    EXPECT_STREQ(message.c_str(), "500");
+  };
+  std::string directory = CreateCacheDirectory();
+  ByteCodeCache::SetDirectory(directory);
+  std::string code = LongScript();
+
+  {
+    auto bridge = TEST_init();
+    bridge->evaluateScript(code.c_str(), code.size(), "vm://", 0);
+  }
+  ASSERT_EQ(ListEntries(directory).size(), 1);
+  std::string entry = ListEntries(directory)[0];
+
+  // Written by another engine version.
+  FlipByte(entry, 8, std::ios::beg);
+  {
+    auto bridge = TEST_init();
+    bridge->evaluateScript(code.c_str(), code.size(), "vm://", 0);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().rejects, 1);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().misses, 1);
+  }
+
+  // Corrupted bytecode.
+  FlipByte(entry, -1, std::ios::end);
+  {
+    auto bridge = TEST_init();
+    bridge->evaluateScript(code.c_str(), code.size(), "vm://", 0);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().rejects, 1);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().misses, 1);
+  }
+
+  // The rejected entry was replaced.
+  {
+    auto bridge = TEST_init();
+    bridge->evaluateScript(code.c_str(), code.size(), "vm://", 0);
+    EXPECT_EQ(bridge->GetExecutingContext()->GetByteCodeCacheStats().hits, 1);
+  }
+
+  ByteCodeCache::SetDirectory("");
+  RemoveCacheDirectory(directory);
+  EXPECT_EQ(logCount, 4);
+}
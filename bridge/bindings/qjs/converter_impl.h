@@ -222,6 +222,8 @@ struct Converter<IDLDOMString> : public ConverterBase<IDLDOMString> {
     return JS_NewUnicodeString(ctx, bytes, length);
   }
   static JSValue ToValue(JSContext* ctx, const std::string& str) { return JS_NewString(ctx, str.c_str()); }
+  // A JS string built natively, returned without atomizing it.
+  static JSValue ToValue(JSContext* ctx, const ScriptValue& value) { return JS_DupValue(ctx, value.QJSValue()); }
 };
 
 template <>
@@ -284,6 +286,22 @@ struct Converter<IDLSequence<T>> : public ConverterBase<IDLSequence<T>> {
 
     return v;
   }
+  // Collect the arguments from argv[start] on, for variadic parameters such as DOMTokenList.add(...tokens).
+  static ImplType FromArguments(JSContext* ctx, int argc, JSValue* argv, int start, ExceptionState& exception_state) {
+    ImplType v;
+    if (argc > start)
+      v.reserve(argc - start);
+
+    for (int i = start; i < argc; i++) {
+      auto&& item = Converter<T>::FromValue(ctx, argv[i], exception_state);
+      if (exception_state.HasException()) {
+        return {};
+      }
+      v.emplace_back(item);
+    }
+
+    return v;
+  }
   static JSValue ToValue(JSContext* ctx, ImplType value) {
     JSValue array = JS_NewArray(ctx);
     JS_SetPropertyStr(ctx, array, "length", Converter<IDLInt64>::ToValue(ctx, value.size()));
@@ -25,6 +25,7 @@ class GCVisitor final {
 
   template <typename T>
   void Trace(const Member<T>& target) {
+    // A deferred wrapper has no JS object to mark, it is kept alive by the document it is connected to.
     if (target.Get() != nullptr) {
       JS_MarkValue(runtime_, target.Get()->jsObject_, markFunc_);
     }
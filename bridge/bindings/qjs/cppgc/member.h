@@ -40,7 +40,7 @@ class Member {
       // We detect the GC phase to handle case two, and free our members by hand(call JS_FreeValueRT directly).
       JSGCPhaseEnum phase = JS_GetEnginePhase(runtime_);
       if (phase == JS_GC_PHASE_DECREF) {
-        JS_FreeValueRT(runtime_, raw_->ToQuickJSUnsafe());
+        To<ScriptWrappable>(raw_)->ReleaseWrapper();
       }
     }
   };
@@ -90,7 +90,7 @@ class Member {
       assert_m(wrappable->GetExecutingContext()->HasMutationScope(),
                "Member must be used after MemberMutationScope allcated.");
       runtime_ = wrappable->runtime();
-      JS_DupValue(wrappable->ctx(), wrappable->ToQuickJSUnsafe());
+      wrappable->RetainWrapper();
     }
     raw_ = p;
   }
@@ -5,8 +5,10 @@
 
 #include "member_installer.h"
 #include <quickjs/quickjs.h>
+#include <atomic>
 #include "core/executing_context.h"
 #include "qjs_engine_patch.h"
+#include "wrapper_type_info.h"
 
 namespace webf {
 
@@ -72,6 +74,45 @@ void MemberInstaller::InstallAttributes(ExecutingContext* context,
   }
 }
 
+// Types of the lazily installed constructors, indexed by class id. Accessors only carry a magic number, the class id,
+// to find their type. Types are static, every context stores the same pointers.
+static std::atomic<const WrapperTypeInfo*> lazy_constructor_types[JS_CLASS_CUSTOM_CLASS_INIT_COUNT];
+
+static JSValue DefineConstructorValue(JSContext* ctx, int magic, JSValueConst value) {
+  ExecutingContext* context = ExecutingContext::From(ctx);
+  const WrapperTypeInfo* type = lazy_constructor_types[magic].load(std::memory_order_relaxed);
+  JS_DefinePropertyValueStr(ctx, context->Global(), type->className, JS_DupValue(ctx, value), JS_PROP_C_W_E);
+  return JS_UNDEFINED;
+}
+
+static JSValue LazyConstructorGetter(JSContext* ctx, JSValueConst this_val, int magic) {
+  ExecutingContext* context = ExecutingContext::From(ctx);
+  const WrapperTypeInfo* type = lazy_constructor_types[magic].load(std::memory_order_relaxed);
+  JSValue constructor = context->contextData()->constructorForType(type);
+  // Later reads are plain property reads.
+  DefineConstructorValue(ctx, magic, constructor);
+  return JS_DupValue(ctx, constructor);
+}
+
+// Scripts may replace the constructor before reading it.
+static JSValue LazyConstructorSetter(JSContext* ctx, JSValueConst this_val, JSValueConst value, int magic) {
+  return DefineConstructorValue(ctx, magic, value);
+}
+
+void MemberInstaller::InstallLazyConstructor(ExecutingContext* context, const WrapperTypeInfo* type) {
+  assert(type->classId < JS_CLASS_CUSTOM_CLASS_INIT_COUNT);
+  lazy_constructor_types[type->classId].store(type, std::memory_order_relaxed);
+
+  JSContext* ctx = context->ctx();
+  JSValue getter = JS_NewCFunction2(ctx, reinterpret_cast<JSCFunction*>(LazyConstructorGetter), type->className, 0,
+                                    JS_CFUNC_getter_magic, static_cast<int>(type->classId));
+  JSValue setter = JS_NewCFunction2(ctx, reinterpret_cast<JSCFunction*>(LazyConstructorSetter), type->className, 1,
+                                    JS_CFUNC_setter_magic, static_cast<int>(type->classId));
+  JSAtom key = JS_NewAtom(ctx, type->className);
+  JS_DefinePropertyGetSet(ctx, context->Global(), key, getter, setter, JS_PROP_C_W_E);
+  JS_FreeAtom(ctx, key);
+}
+
 void MemberInstaller::InstallFunctions(ExecutingContext* context,
                                        JSValue root,
                                        std::initializer_list<FunctionConfig> config) {
@@ -12,6 +12,7 @@
 namespace webf {
 
 class ExecutingContext;
+class WrapperTypeInfo;
 
 // Flags for object properties.
 enum JSPropFlag {
@@ -47,6 +48,9 @@ class MemberInstaller {
 
   static void InstallAttributes(ExecutingContext* context, JSValue root, std::initializer_list<AttributeConfig> config);
   static void InstallFunctions(ExecutingContext* context, JSValue root, std::initializer_list<FunctionConfig> config);
+  // Define the constructor of |type| on the global object as an accessor. The constructor and its prototype chain are
+  // created on first read, and the accessor is then replaced by the constructor itself.
+  static void InstallLazyConstructor(ExecutingContext* context, const WrapperTypeInfo* type);
 };
 
 }  // namespace webf
@@ -7,6 +7,7 @@
 #include <quickjs/cutils.h>
 #include <quickjs/list.h>
 #include <cstring>
+#include "foundation/dart_readable.h"
 
 typedef struct JSProxyData {
   JSValue target;
@@ -251,14 +252,14 @@ uint16_t* JS_ToUnicode(JSContext* ctx, JSValueConst value, uint32_t* length) {
   if (!string->is_wide_char) {
     uint8_t* p = string->u.str8;
     uint32_t len = *length = string->len;
-    buffer = (uint16_t*)malloc(sizeof(uint16_t) * len * 2);
+    buffer = (uint16_t*)webf::dart_malloc(sizeof(uint16_t) * len * 2);
     for (size_t i = 0; i < len; i++) {
       buffer[i] = p[i];
       buffer[i + 1] = 0x00;
     }
   } else {
     *length = string->len;
-    buffer = (uint16_t*)malloc(sizeof(uint16_t) * string->len);
+    buffer = (uint16_t*)webf::dart_malloc(sizeof(uint16_t) * string->len);
     memcpy(buffer, string->u.str16, sizeof(uint16_t) * string->len);
   }
 
@@ -19,6 +19,9 @@ class QJSInterfaceBridge {
   }
 
   static bool HasInstance(ExecutingContext* context, JSValue value) {
+    // No object can inherit from a prototype which was not created yet, avoid creating it for the check.
+    if (!context->contextData()->hasConstructorForType(QJST::GetWrapperTypeInfo()))
+      return false;
     return JS_IsInstanceOf(context->ctx(), value,
                            context->contextData()->constructorForType(QJST::GetWrapperTypeInfo()));
   };
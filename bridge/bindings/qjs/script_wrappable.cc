@@ -13,17 +13,60 @@ ScriptWrappable::ScriptWrappable(JSContext* ctx)
     : ctx_(ctx), runtime_(JS_GetRuntime(ctx)), context_(ExecutingContext::From(ctx)) {}
 
 JSValue ScriptWrappable::ToQuickJS() const {
+  EnsureQuickJSObject();
   return JS_DupValue(ctx_, jsObject_);
 }
 
 JSValue ScriptWrappable::ToQuickJSUnsafe() const {
+  EnsureQuickJSObject();
   return jsObject_;
 }
 
 ScriptValue ScriptWrappable::ToValue() {
+  EnsureQuickJSObject();
   return ScriptValue(ctx_, jsObject_);
 }
 
+void ScriptWrappable::RetainWrapper() {
+  if (UNLIKELY(JS_IsNull(jsObject_))) {
+    deferred_ref_count_++;
+    return;
+  }
+  JS_DupValue(ctx_, jsObject_);
+}
+
+void ScriptWrappable::ReleaseWrapper() {
+  if (UNLIKELY(JS_IsNull(jsObject_))) {
+    assert(deferred_ref_count_ > 0);
+    if (deferred_ref_count_ > 1) {
+      deferred_ref_count_--;
+      return;
+    }
+    // The last reference is gone, let the finalizer of the JS object free the object and its members.
+    EnsureQuickJSObject();
+  }
+  JS_FreeValueRT(runtime_, jsObject_);
+}
+
+void ScriptWrappable::EnsureQuickJSObject() const {
+  if (LIKELY(!JS_IsNull(jsObject_)))
+    return;
+
+  assert(deferred_ref_count_ > 0);
+  auto* self = const_cast<ScriptWrappable*>(this);
+  self->CreateQuickJSObject();
+  // The new object holds one reference, the JS object takes over the others counted while it was deferred.
+  for (int32_t i = 1; i < deferred_ref_count_; i++) {
+    JS_DupValue(ctx_, jsObject_);
+  }
+  deferred_ref_count_ = 0;
+  context_->UnregisterDeferredWrapper(self);
+}
+
+bool ScriptWrappable::CanDeferQuickJSObject() const {
+  return false;
+}
+
 /// This callback will be called when QuickJS GC is running at marking stage.
 /// Users of this class should override `void Trace(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)` to
 /// tell GC which member of their class should be collected by GC.
@@ -154,6 +197,22 @@ static int HandleJSGetOwnProperty(JSContext* ctx, JSPropertyDescriptor* desc, JS
 }
 
 void ScriptWrappable::InitializeQuickJSObject() {
+  if (context_->DefersWrapperCreation() && CanDeferQuickJSObject() && !KeepAlive()) {
+    // The reference of the JS object returned to the allocating Local.
+    deferred_ref_count_ = 1;
+    context_->RegisterDeferredWrapper(this);
+    return;
+  }
+
+  CreateQuickJSObject();
+
+  if (KeepAlive()) {
+    JS_DupValue(ctx_, jsObject_);
+    context_->RegisterActiveScriptWrappers(this);
+  }
+}
+
+void ScriptWrappable::CreateQuickJSObject() {
   auto* wrapper_type_info = GetWrapperTypeInfo();
   JSRuntime* runtime = runtime_;
 
@@ -236,21 +295,25 @@ void ScriptWrappable::InitializeQuickJSObject() {
   /// within JavaScript code. When the reference count of `jsObject` decrease to 0, QuickJS will trigger `finalizer`
   /// callback and free `jsObject` memory. When QuickJS GC found `jsObject` at marking stage, `gc_mark` callback will be
   /// triggered.
-  jsObject_ = JS_NewObjectClass(ctx_, wrapper_type_info->classId);
-  JS_SetOpaque(jsObject_, this);
-
-  if (KeepAlive()) {
-    JS_DupValue(ctx_, jsObject_);
-    context_->RegisterActiveScriptWrappers(this);
-  }
-
-  // Let our instance into inherit prototype methods.
+  ///
+  /// The object is created with its prototype at once: setting the prototype afterwards unshares the hashed shape of
+  /// the object, so every wrapper, e.g. each node built by the HTML parser, would own a private copy of it.
   JSValue prototype = GetExecutingContext()->contextData()->prototypeForType(wrapper_type_info);
-  JS_SetPrototype(ctx_, jsObject_, prototype);
+  jsObject_ = JS_NewObjectProtoClass(ctx_, prototype, wrapper_type_info->classId);
+  JS_SetOpaque(jsObject_, this);
 }
 
 bool ScriptWrappable::KeepAlive() const {
   return false;
 }
 
+DeferredWrapperCreationScope::DeferredWrapperCreationScope(ExecutingContext* context, bool enabled)
+    : context_(context), previous_(context->DefersWrapperCreation()) {
+  context_->SetDefersWrapperCreation(enabled);
+}
+
+DeferredWrapperCreationScope::~DeferredWrapperCreationScope() {
+  context_->SetDefersWrapperCreation(previous_);
+}
+
 }  // namespace webf
@@ -36,6 +36,11 @@ class GCVisitor;
 // JavaScript object (platform object).  ToQuickJS() converts a ScriptWrappable to
 // a QuickJS object and toScriptWrappable() converts a QuickJS object back to
 // a ScriptWrappable.
+//
+// The JS object owns the native object: Members and handles hold references on it and its finalizer deletes the
+// native object. Wrappers created in a DeferredWrapperCreationScope, e.g. the nodes built by the HTML parser, don't
+// create their JS object until they are exposed to script. Until then the references are counted on the native
+// object, and the JS object takes them over once it is created.
 class ScriptWrappable : public GarbageCollected<ScriptWrappable> {
  public:
   ScriptWrappable() = delete;
@@ -48,10 +53,18 @@ class ScriptWrappable : public GarbageCollected<ScriptWrappable> {
 
   void Trace(GCVisitor* visitor) const override{};
 
+  // These create the JS object of a deferred wrapper.
   virtual JSValue ToQuickJS() const;
   JSValue ToQuickJSUnsafe() const;
-
   ScriptValue ToValue();
+
+  // Take or drop a reference on the wrapper without creating the JS object of a deferred wrapper.
+  void RetainWrapper();
+  void ReleaseWrapper();
+
+  // Create the JS object of a deferred wrapper now.
+  void EnsureQuickJSObject() const;
+
   FORCE_INLINE ExecutingContext* GetExecutingContext() const { return context_; };
   FORCE_INLINE JSContext* ctx() const { return ctx_; }
   FORCE_INLINE JSRuntime* runtime() const { return runtime_; }
@@ -65,8 +78,18 @@ class ScriptWrappable : public GarbageCollected<ScriptWrappable> {
    */
   virtual bool KeepAlive() const;
 
+ protected:
+  // Whether the JS object can be created on first exposure when the wrapper is created in a
+  // DeferredWrapperCreationScope. Only objects which are kept alive by the document they belong to while they are
+  // deferred can return true: a QuickJS GC can't trace the references held by an object without JS object.
+  virtual bool CanDeferQuickJSObject() const;
+
  private:
-  JSValue jsObject_{JS_NULL};
+  void CreateQuickJSObject();
+
+  mutable JSValue jsObject_{JS_NULL};
+  // The references taken while the JS object is not created.
+  mutable int32_t deferred_ref_count_{0};
   JSContext* ctx_{nullptr};
   ExecutingContext* context_{nullptr};
   JSRuntime* runtime_{nullptr};
@@ -79,6 +102,20 @@ inline ScriptWrappable* toScriptWrappable(JSValue object) {
   return static_cast<ScriptWrappable*>(JS_GetOpaque(object, JSValueGetClassId(object)));
 }
 
+// Wrappers created while the scope is alive and |enabled| is true defer the creation of their JS object.
+class DeferredWrapperCreationScope {
+  WEBF_DISALLOW_NEW();
+  WEBF_DISALLOW_COPY_AND_ASSIGN(DeferredWrapperCreationScope);
+
+ public:
+  DeferredWrapperCreationScope(ExecutingContext* context, bool enabled);
+  ~DeferredWrapperCreationScope();
+
+ private:
+  ExecutingContext* context_;
+  bool previous_;
+};
+
 template <typename T>
 Local<T>::~Local<T>() {
   if (raw_ == nullptr)
@@ -12,6 +12,7 @@
 namespace webf {
 
 class EventTarget;
+class ExecutingContext;
 class TouchList;
 
 // Define all built-in wrapper class id.
@@ -52,10 +53,12 @@ enum {
   JS_CLASS_TEXT,
   JS_CLASS_COMMENT,
   JS_CLASS_NODE_LIST,
+  JS_CLASS_DOM_TOKEN_LIST,
   JS_CLASS_DOCUMENT_FRAGMENT,
   JS_CLASS_BOUNDING_CLIENT_RECT,
   JS_CLASS_ELEMENT_ATTRIBUTES,
   JS_CLASS_HTML_ALL_COLLECTION,
+  JS_CLASS_HTML_COLLECTION,
   JS_CLASS_HTML_ELEMENT,
   JS_CLASS_WIDGET_ELEMENT,
   JS_CLASS_HTML_DIV_ELEMENT,
@@ -105,6 +108,9 @@ using PropertyCheckerHandler = bool (*)(JSContext* ctx, JSValueConst obj, JSAtom
 // exp: Object.keys(obj);
 using PropertyEnumerateHandler = int (*)(JSContext* ctx, JSPropertyEnum** ptab, uint32_t* plen, JSValueConst obj);
 
+// Callback when the prototype of a class is created in a context, to define its methods and attributes.
+using InstallPrototypeHandler = void (*)(ExecutingContext* context);
+
 // This struct provides a way to store a bunch of information that is helpful
 // when creating quickjs objects. Each quickjs bindings class has exactly one static
 // WrapperTypeInfo member, so comparing pointers is a safe way to determine if
@@ -125,6 +131,7 @@ class WrapperTypeInfo final {
   const char* className{nullptr};
   const WrapperTypeInfo* parent_class{nullptr};
   JSClassCall* callFunc{nullptr};
+  InstallPrototypeHandler install_prototype_handler_{nullptr};
   IndexedPropertyGetterHandler indexed_property_getter_handler_{nullptr};
   IndexedPropertySetterHandler indexed_property_setter_handler_{nullptr};
   StringPropertyGetterHandler string_property_getter_handler_{nullptr};
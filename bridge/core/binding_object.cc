@@ -4,9 +4,10 @@
  */
 
 #include "binding_object.h"
-#include "binding_call_methods.h"
+#include <algorithm>
 #include "bindings/qjs/exception_state.h"
 #include "bindings/qjs/script_promise_resolver.h"
+#include "core/dom/document.h"
 #include "core/dom/events/event_target.h"
 #include "core/executing_context.h"
 #include "foundation/native_value_converter.h"
@@ -47,21 +48,19 @@ void BindingObject::FullFillPendingPromise(BindingObjectPromiseContext* binding_
   pending_promise_contexts_.erase(binding_object_promise_context);
 }
 
-NativeValue BindingObject::InvokeBindingMethod(const AtomicString& method,
+NativeValue BindingObject::InvokeBindingMethod(BindingMethodId method,
                                                int32_t argc,
                                                const NativeValue* argv,
                                                ExceptionState& exception_state) const {
-  context_->FlushUICommand();
-  if (binding_object_->invoke_bindings_methods_from_native == nullptr) {
-    exception_state.ThrowException(context_->ctx(), ErrorType::InternalError,
-                                   "Failed to call dart method: invoke_bindings_methods_from_native not initialized.");
-    return Native_NewNull();
+  FlushUICommandObservedBy(method);
+  NativeValue native_method =
+      NativeValueConverter<NativeTypeInt64>::ToNativeValue(BindingMethodCallOperations::kInvokeMethod);
+  native_method.uint32 = static_cast<uint32_t>(method);
+  NativeValue result = InvokeDartMethod(native_method, argc, argv, exception_state);
+  if (kBindingMethodIdChangesLayout[static_cast<int32_t>(method)]) {
+    InvalidateLayout();
   }
-
-  NativeValue return_value = Native_NewNull();
-  NativeValue native_method = NativeValueConverter<NativeTypeString>::ToNativeValue(context_->ctx(), method);
-  binding_object_->invoke_bindings_methods_from_native(binding_object_, &return_value, &native_method, argc, argv);
-  return return_value;
+  return result;
 }
 
 NativeValue BindingObject::InvokeBindingMethod(BindingMethodCallOperations binding_method_call_operation,
@@ -69,6 +68,21 @@ NativeValue BindingObject::InvokeBindingMethod(BindingMethodCallOperations bindi
                                                const NativeValue* argv,
                                                ExceptionState& exception_state) const {
   context_->FlushUICommand();
+  NativeValue native_method = NativeValueConverter<NativeTypeInt64>::ToNativeValue(binding_method_call_operation);
+  NativeValue result = InvokeDartMethod(native_method, argc, argv, exception_state);
+  // Setters and the methods of widget elements are free to change layout.
+  if (binding_method_call_operation != BindingMethodCallOperations::kGetProperty &&
+      binding_method_call_operation != BindingMethodCallOperations::kGetPropertiesBatch &&
+      binding_method_call_operation != BindingMethodCallOperations::kGetAllPropertyNames) {
+    InvalidateLayout();
+  }
+  return result;
+}
+
+NativeValue BindingObject::InvokeDartMethod(NativeValue native_method,
+                                            size_t argc,
+                                            const NativeValue* argv,
+                                            ExceptionState& exception_state) const {
   if (binding_object_->invoke_bindings_methods_from_native == nullptr) {
     exception_state.ThrowException(context_->ctx(), ErrorType::InternalError,
                                    "Failed to call dart method: invoke_bindings_methods_from_native not initialized.");
@@ -76,21 +90,59 @@ NativeValue BindingObject::InvokeBindingMethod(BindingMethodCallOperations bindi
   }
 
   NativeValue return_value = Native_NewNull();
-  NativeValue native_method = NativeValueConverter<NativeTypeInt64>::ToNativeValue(binding_method_call_operation);
   binding_object_->invoke_bindings_methods_from_native(binding_object_, &return_value, &native_method, argc, argv);
   return return_value;
 }
 
-NativeValue BindingObject::GetBindingProperty(const AtomicString& prop, ExceptionState& exception_state) const {
+void BindingObject::InvalidateLayout() const {
+  if (Document* document = context_->document()) {
+    document->InvalidateLayout();
+  }
+}
+
+void BindingObject::FlushUICommandObservedBy(BindingMethodId method) const {
+  UICommandBuffer* buffer = context_->uiCommandBuffer();
+  if (buffer->empty())
+    return;
+
+  // Only event targets are the target of UI commands, other objects can not tell which commands they depend on.
+  if (!kBindingMethodIdDependsOnLayout[static_cast<int32_t>(method)] && IsEventTarget() &&
+      !buffer->HasPendingCommands(static_cast<const EventTarget*>(this)->eventTargetId())) {
+    buffer->RecordAvoidedFlush();
+    return;
+  }
+
   context_->FlushUICommand();
+}
+
+NativeValue BindingObject::GetBindingProperty(BindingMethodId prop, ExceptionState& exception_state) const {
+  FlushUICommandObservedBy(prop);
+  const NativeValue argv[] = {NativeValueConverter<NativeTypeInt64>::ToNativeValue(static_cast<int64_t>(prop))};
+  NativeValue native_method =
+      NativeValueConverter<NativeTypeInt64>::ToNativeValue(BindingMethodCallOperations::kGetProperty);
+  return InvokeDartMethod(native_method, 1, argv, exception_state);
+}
+
+NativeValue BindingObject::GetBindingProperty(const AtomicString& prop, ExceptionState& exception_state) const {
   const NativeValue argv[] = {Native_NewString(prop.ToNativeString(context_->ctx()).release())};
   return InvokeBindingMethod(BindingMethodCallOperations::kGetProperty, 1, argv, exception_state);
 }
 
+NativeValue BindingObject::SetBindingProperty(BindingMethodId prop,
+                                              NativeValue value,
+                                              ExceptionState& exception_state) const {
+  FlushUICommandObservedBy(prop);
+  const NativeValue argv[] = {NativeValueConverter<NativeTypeInt64>::ToNativeValue(static_cast<int64_t>(prop)), value};
+  NativeValue native_method =
+      NativeValueConverter<NativeTypeInt64>::ToNativeValue(BindingMethodCallOperations::kSetProperty);
+  NativeValue result = InvokeDartMethod(native_method, 2, argv, exception_state);
+  InvalidateLayout();
+  return result;
+}
+
 NativeValue BindingObject::SetBindingProperty(const AtomicString& prop,
                                               NativeValue value,
                                               ExceptionState& exception_state) const {
-  context_->FlushUICommand();
   const NativeValue argv[] = {Native_NewString(prop.ToNativeString(context_->ctx()).release()), value};
   return InvokeBindingMethod(BindingMethodCallOperations::kSetProperty, 2, argv, exception_state);
 }
@@ -199,10 +251,27 @@ ScriptValue BindingObject::AnonymousAsyncFunctionCallback(JSContext* ctx,
 }
 
 NativeValue BindingObject::GetAllBindingPropertyNames(ExceptionState& exception_state) const {
-  context_->FlushUICommand();
   return InvokeBindingMethod(BindingMethodCallOperations::kGetAllPropertyNames, 0, nullptr, exception_state);
 }
 
+void BindingObject::GetBindingProperties(const std::vector<BindingPropertyQuery>& queries,
+                                         NativeValue* results,
+                                         ExceptionState& exception_state) const {
+  std::fill(results, results + queries.size(), Native_NewNull());
+  if (queries.empty())
+    return;
+
+  // The output buffer, followed by a target and a property for each query.
+  std::vector<NativeValue> argv;
+  argv.reserve(queries.size() * 2 + 1);
+  argv.emplace_back(Native_NewPtr(JSPointerType::Others, results));
+  for (auto& query : queries) {
+    argv.emplace_back(Native_NewPtr(JSPointerType::Others, query.target->bindingObject()));
+    argv.emplace_back(query.property);
+  }
+  InvokeBindingMethod(BindingMethodCallOperations::kGetPropertiesBatch, argv.size(), argv.data(), exception_state);
+}
+
 void BindingObject::Trace(GCVisitor* visitor) const {
   for (auto&& promise_context : pending_promise_contexts_) {
     promise_context->promise_resolver->Trace(visitor);
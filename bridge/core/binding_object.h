@@ -8,6 +8,8 @@
 
 #include <cinttypes>
 #include <set>
+#include <vector>
+#include "binding_call_method_ids.h"
 #include "bindings/qjs/atomic_string.h"
 #include "foundation/native_type.h"
 #include "foundation/native_value.h"
@@ -55,6 +57,16 @@ enum BindingMethodCallOperations {
   kGetAllPropertyNames,
   kAnonymousFunctionCall,
   kAsyncAnonymousFunction,
+  // Call a method known by the code generator, the BindingMethodId of the method is stored in NativeValue::uint32.
+  kInvokeMethod,
+  // Read the properties of several binding objects at once, see BindingObject::GetBindingProperties.
+  kGetPropertiesBatch,
+};
+
+// A property of |target| to read in a batch, |property| is a BindingMethodId (int64) or a property name (string).
+struct BindingPropertyQuery {
+  const BindingObject* target;
+  NativeValue property;
 };
 
 struct BindingObjectPromiseContext : public DartReadable {
@@ -92,13 +104,21 @@ class BindingObject {
   // Handle call from dart side.
   virtual NativeValue HandleCallFromDartSide(const NativeValue* method, int32_t argc, const NativeValue* argv) = 0;
   // Invoke methods which implemented at dart side.
-  NativeValue InvokeBindingMethod(const AtomicString& method,
+  NativeValue InvokeBindingMethod(BindingMethodId method,
                                   int32_t argc,
                                   const NativeValue* args,
                                   ExceptionState& exception_state) const;
+  // Properties known by the code generator are sent by id, |prop| names are only used for dynamic widget properties.
+  NativeValue GetBindingProperty(BindingMethodId prop, ExceptionState& exception_state) const;
   NativeValue GetBindingProperty(const AtomicString& prop, ExceptionState& exception_state) const;
+  NativeValue SetBindingProperty(BindingMethodId prop, NativeValue value, ExceptionState& exception_state) const;
   NativeValue SetBindingProperty(const AtomicString& prop, NativeValue value, ExceptionState& exception_state) const;
   NativeValue GetAllBindingPropertyNames(ExceptionState& exception_state) const;
+  // Read the properties of any binding objects with a single call to dart side, the value of queries[i] is written to
+  // results[i]. Properties which are not found are null.
+  void GetBindingProperties(const std::vector<BindingPropertyQuery>& queries,
+                            NativeValue* results,
+                            ExceptionState& exception_state) const;
 
   NativeBindingObject* bindingObject() const { return binding_object_; }
 
@@ -122,10 +142,20 @@ class BindingObject {
                                   const NativeValue* args,
                                   ExceptionState& exception_state) const;
 
+  // Drop the element geometry read before dart side may have changed layout.
+  void InvalidateLayout() const;
+
   // NativeBindingObject may allocated at Dart side. Binding this with Dart allocated NativeBindingObject.
   explicit BindingObject(ExecutingContext* context, NativeBindingObject* native_binding_object);
 
  private:
+  NativeValue InvokeDartMethod(NativeValue native_method,
+                               size_t argc,
+                               const NativeValue* args,
+                               ExceptionState& exception_state) const;
+  // Flush the pending UI commands before a synchronous call, unless none of them could change its result.
+  void FlushUICommandObservedBy(BindingMethodId method) const;
+
   ExecutingContext* context_{nullptr};
   NativeBindingObject* binding_object_{new NativeBindingObject(this)};
   std::set<BindingObjectPromiseContext*> pending_promise_contexts_;
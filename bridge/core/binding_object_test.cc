@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "binding_object.h"
+#include "core/dom/document.h"
+#include "core/frame/window.h"
+#include "core/html/html_body_element.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(BindingObject, callKnownMethodsAndPropertiesById) {
+  bool static errorCalled = false;
+  static std::vector<NativeValue> methods;
+  static std::vector<NativeValue> first_arguments;
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* context = bridge->GetExecutingContext();
+  NativeBindingObject* native_binding_object = context->document()->body()->bindingObject();
+  native_binding_object->invoke_bindings_methods_from_native =
+      [](const NativeBindingObject* binding_object, NativeValue* return_value, NativeValue* method, int32_t argc,
+         const NativeValue* argv) {
+        methods.emplace_back(*method);
+        first_arguments.emplace_back(argc > 0 ? argv[0] : Native_NewNull());
+        if (method->u.int64 == BindingMethodCallOperations::kGetProperty) {
+          *return_value = Native_NewCString("webf");
+        }
+      };
+
+  const char* code = "document.body.click(); document.body.name;";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  native_binding_object->invoke_bindings_methods_from_native = nullptr;
+
+  EXPECT_EQ(errorCalled, false);
+  ASSERT_EQ(methods.size(), 2);
+
+  EXPECT_EQ(methods[0].tag, NativeTag::TAG_INT);
+  EXPECT_EQ(methods[0].u.int64, BindingMethodCallOperations::kInvokeMethod);
+  EXPECT_EQ(methods[0].uint32, static_cast<uint32_t>(BindingMethodId::kclick));
+
+  EXPECT_EQ(methods[1].tag, NativeTag::TAG_INT);
+  EXPECT_EQ(methods[1].u.int64, BindingMethodCallOperations::kGetProperty);
+  EXPECT_EQ(first_arguments[1].tag, NativeTag::TAG_INT);
+  EXPECT_EQ(first_arguments[1].u.int64, static_cast<int64_t>(BindingMethodId::kname));
+  EXPECT_STREQ(kBindingMethodIdNames[first_arguments[1].u.int64], "name");
+}
+
+TEST(BindingObject, flushOnlyWhenPendingCommandsAreObserved) {
+  bool static errorCalled = false;
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  NativeBindingObject* native_binding_object = context->window()->bindingObject();
+  native_binding_object->invoke_bindings_methods_from_native =
+      [](const NativeBindingObject* binding_object, NativeValue* return_value, NativeValue* method, int32_t argc,
+         const NativeValue* argv) { *return_value = Native_NewFloat64(100); };
+  context->FlushUICommand();
+
+  // The size of the viewport does not depend on the new div.
+  const char* code = "document.body.appendChild(document.createElement('div')); window.innerWidth;";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_FALSE(buffer->empty());
+  EXPECT_EQ(buffer->AvoidedFlushCount(), 1);
+
+  // The scroll offset does.
+  const char* layout = "window.scrollX;";
+  bridge->evaluateScript(layout, strlen(layout), "vm://", 0);
+  EXPECT_TRUE(buffer->empty());
+  EXPECT_EQ(buffer->AvoidedFlushCount(), 1);
+
+  native_binding_object->invoke_bindings_methods_from_native = nullptr;
+  EXPECT_EQ(errorCalled, false);
+}
+
+TEST(BindingObject, batchReadPropertiesInOneCall) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  static int calls = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "1,2,3");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* context = bridge->GetExecutingContext();
+  // The first target dispatches the batch.
+  NativeBindingObject* native_binding_object = context->document()->body()->bindingObject();
+  native_binding_object->invoke_bindings_methods_from_native =
+      [](const NativeBindingObject* binding_object, NativeValue* return_value, NativeValue* method, int32_t argc,
+         const NativeValue* argv) {
+        calls++;
+        ASSERT_EQ(method->u.int64, BindingMethodCallOperations::kGetPropertiesBatch);
+        ASSERT_EQ(argc, 7);
+        auto* results = static_cast<NativeValue*>(argv[0].u.ptr);
+        for (int32_t i = 0; i < 3; i++) {
+          EXPECT_EQ(argv[1 + i * 2].tag, NativeTag::TAG_POINTER);
+          results[i] = Native_NewFloat64(i + 1);
+        }
+      };
+
+  const char* code =
+      "let div = document.createElement('div');"
+      "console.log(webf.batchRead([document.body, div, document.documentElement],"
+      "  ['scrollTop', 'value', 'title']).join(','));";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  native_binding_object->invoke_bindings_methods_from_native = nullptr;
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
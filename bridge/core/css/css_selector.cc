@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "css_selector.h"
+
+namespace webf {
+
+bool CSSSelector::MatchNth(int count) const {
+  if (nth_a_ == 0)
+    return count == nth_b_;
+  // count = a * n + b for some n >= 0. The parser clamps a and b to the range of int, the difference may not fit.
+  int64_t diff = static_cast<int64_t>(count) - nth_b_;
+  if (nth_a_ > 0)
+    return diff >= 0 && diff % nth_a_ == 0;
+  return diff <= 0 && diff % nth_a_ == 0;
+}
+
+}  // namespace webf
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_CSS_CSS_SELECTOR_H_
+#define BRIDGE_CORE_CSS_CSS_SELECTOR_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+
+namespace webf {
+
+class CSSSelectorList;
+
+// A simple selector, such as "div", ".item", "[href^='http']" or ":first-child".
+//
+// Simple selectors of a complex selector are stored from right to left. Every simple selector of a compound selector
+// has kSubSelector relation except the last one, which holds the combinator to the compound selector on its left.
+// For example, "ul > li.item" is stored as: [.item (kSubSelector), li (kChild), ul (kSubSelector)].
+class CSSSelector {
+ public:
+  enum MatchType {
+    kUniversal,         // *
+    kTag,               // div
+    kId,                // #id
+    kClass,             // .class
+    kPseudoClass,       // :first-child
+    kAttributeSet,      // [attr]
+    kAttributeExact,    // [attr=value]
+    kAttributeList,     // [attr~=value]
+    kAttributeHyphen,   // [attr|=value]
+    kAttributeBegin,    // [attr^=value]
+    kAttributeEnd,      // [attr$=value]
+    kAttributeContain,  // [attr*=value]
+  };
+
+  enum RelationType {
+    kSubSelector,       // No combinator, in the same compound selector.
+    kDescendant,        // "Space" combinator
+    kChild,             // > combinator
+    kDirectAdjacent,    // + combinator
+    kIndirectAdjacent,  // ~ combinator
+  };
+
+  enum PseudoType {
+    kPseudoUnknown,
+    kPseudoRoot,
+    kPseudoScope,
+    kPseudoEmpty,
+    kPseudoFirstChild,
+    kPseudoLastChild,
+    kPseudoOnlyChild,
+    kPseudoFirstOfType,
+    kPseudoLastOfType,
+    kPseudoOnlyOfType,
+    kPseudoNthChild,
+    kPseudoNthLastChild,
+    kPseudoNthOfType,
+    kPseudoNthLastOfType,
+    kPseudoNot,
+    kPseudoIs,
+  };
+
+  enum AttributeMatchType {
+    kCaseSensitive,
+    kCaseInsensitive,
+  };
+
+  explicit CSSSelector(MatchType match) : match_(match) {}
+  CSSSelector(CSSSelector&&) noexcept = default;
+  CSSSelector& operator=(CSSSelector&&) noexcept = default;
+
+  MatchType Match() const { return match_; }
+  RelationType Relation() const { return relation_; }
+  PseudoType GetPseudoType() const { return pseudo_type_; }
+  AttributeMatchType AttributeMatch() const { return attribute_match_; }
+
+  // Tag name in lower case, id, class name or attribute value.
+  const AtomicString& Value() const { return value_; }
+  // Upper case tag name, elements created with document.createElement('DIV') keep the upper case tag name.
+  const AtomicString& UpperValue() const { return upper_value_; }
+  // UTF-8 attribute value, used by the substring attribute selectors.
+  const std::string& ValueString() const { return value_string_; }
+  const AtomicString& Attribute() const { return attribute_; }
+  // Selector list argument of :not() and :is().
+  const CSSSelectorList* SelectorList() const { return selector_list_.get(); }
+
+  // Whether |count| (1-based) is matched by the an+b expression of a :nth-* pseudo class.
+  bool MatchNth(int count) const;
+
+ private:
+  friend class CSSSelectorParser;
+
+  MatchType match_;
+  RelationType relation_{kSubSelector};
+  PseudoType pseudo_type_{kPseudoUnknown};
+  AttributeMatchType attribute_match_{kCaseSensitive};
+  AtomicString value_;
+  AtomicString upper_value_;
+  std::string value_string_;
+  AtomicString attribute_;
+  int nth_a_{0};
+  int nth_b_{0};
+  std::unique_ptr<CSSSelectorList> selector_list_;
+};
+
+// A list of complex selectors separated by comma, such as "div.item, #main > p".
+class CSSSelectorList {
+ public:
+  using ComplexSelector = std::vector<CSSSelector>;
+
+  explicit CSSSelectorList(std::vector<ComplexSelector>&& selectors) : selectors_(std::move(selectors)) {}
+
+  const std::vector<ComplexSelector>& Selectors() const { return selectors_; }
+
+ private:
+  std::vector<ComplexSelector> selectors_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_CSS_CSS_SELECTOR_H_
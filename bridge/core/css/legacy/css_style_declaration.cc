@@ -3,10 +3,11 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 #include "css_style_declaration.h"
+#include <algorithm>
 #include <vector>
 #include "core/dom/element.h"
+#include "core/css/parser/css_declaration_parser.h"
 #include "core/executing_context.h"
-#include "css_property_list.h"
 
 namespace webf {
 
@@ -20,36 +21,114 @@ inline CharacterType toASCIIUpper(CharacterType character) {
   return character & ~(isASCIILower(character) << 5);
 }
 
-static std::string parseJavaScriptCSSPropertyName(std::string& propertyName) {
-  static std::unordered_map<std::string, std::string> propertyCache{};
+// Convert the names out of the property table, such as custom properties, to camelCase.
+static std::string parseJavaScriptCSSPropertyName(const std::string& propertyName) {
+  std::string result;
+  result.reserve(propertyName.size());
 
-  if (propertyCache.count(propertyName) > 0) {
-    return propertyCache[propertyName];
-  }
-
-  std::vector<char> buffer(propertyName.size() + 1);
-
-  size_t hyphen = 0;
   for (size_t i = 0; i < propertyName.size(); ++i) {
-    char c = propertyName[i + hyphen];
-    if (!c)
-      break;
-    if (c == '-') {
-      hyphen++;
-      buffer[i] = toASCIIUpper(propertyName[i + hyphen]);
+    char c = propertyName[i];
+    if (c == '-' && i + 1 < propertyName.size()) {
+      result.push_back(toASCIIUpper(propertyName[++i]));
     } else {
-      buffer[i] = c;
+      result.push_back(c);
     }
   }
 
-  buffer.emplace_back('\0');
+  return result;
+}
+
+static CSSPropertyID PropertyIDFromKey(const AtomicString& key) {
+  // Integer like keys are stored as tagged int atoms, there are no string storage behind them.
+  if ((key.Impl() & JS_ATOM_TAG_INT) || key.IsEmpty())
+    return CSSPropertyID::kInvalid;
 
-  std::string result = std::string(buffer.data());
+  StringView name = key.ToStringView();
+  if (name.Is8Bit())
+    return CSSPropertyIDFromName(name.Characters8(), name.length());
+  return CSSPropertyIDFromName(name.Characters16(), name.length());
+}
 
-  propertyCache[propertyName] = result;
-  return result;
+// kSetStyleById passes the property id in the nativePtr slot of the command.
+static void* PropertyIDPayload(CSSPropertyID id) {
+  return reinterpret_cast<void*>(static_cast<intptr_t>(id));
 }
 
+static std::vector<std::pair<CSSPropertyID, AtomicString>>::iterator LowerBound(
+    std::vector<std::pair<CSSPropertyID, AtomicString>>& properties,
+    CSSPropertyID id) {
+  return std::lower_bound(properties.begin(), properties.end(), id,
+                          [](const std::pair<CSSPropertyID, AtomicString>& property, CSSPropertyID id) {
+                            return property.first < id;
+                          });
+}
+
+static std::vector<std::pair<std::string, AtomicString>>::iterator FindByName(
+    std::vector<std::pair<std::string, AtomicString>>& properties,
+    const std::string& name) {
+  return std::find_if(properties.begin(), properties.end(),
+                      [&name](const std::pair<std::string, AtomicString>& property) { return property.first == name; });
+}
+
+// Returns false when the property already has the value.
+static bool SetPropertyValue(std::vector<std::pair<CSSPropertyID, AtomicString>>& properties,
+                             CSSPropertyID id,
+                             const AtomicString& value) {
+  auto it = LowerBound(properties, id);
+  if (it == properties.end() || it->first != id) {
+    properties.insert(it, std::make_pair(id, value));
+    return true;
+  }
+  if (it->second == value)
+    return false;
+  it->second = value;
+  return true;
+}
+
+static bool SetPropertyValue(std::vector<std::pair<std::string, AtomicString>>& properties,
+                             const std::string& name,
+                             const AtomicString& value) {
+  auto it = FindByName(properties, name);
+  if (it == properties.end()) {
+    properties.emplace_back(name, value);
+    return true;
+  }
+  if (it->second == value)
+    return false;
+  it->second = value;
+  return true;
+}
+
+namespace {
+
+// Collects the changes of SetCSSText() into one kSetStyles command.
+class StyleCommandBatch {
+ public:
+  void Add(CSSPropertyID id, const std::string& value) { Add(std::to_string(static_cast<int32_t>(id)), value); }
+
+  void Add(const std::string& key, const std::string& value) {
+    if (count_++ > 0) {
+      keys_ += ',';
+      values_ += '\0';
+    }
+    keys_ += key;
+    values_ += value;
+  }
+
+  void Commit(ExecutingContext* context, int32_t target_id) {
+    if (count_ == 0)
+      return;
+    context->uiCommandBuffer()->addCommand(target_id, UICommand::kSetStyles, keys_, values_, nullptr);
+  }
+
+ private:
+  std::string keys_;
+  std::string values_;
+  size_t count_{0};
+};
+
+}  // namespace
+
 CSSStyleDeclaration* CSSStyleDeclaration::Create(ExecutingContext* context, ExceptionState& exception_state) {
   exception_state.ThrowException(context->ctx(), ErrorType::TypeError, "Illegal constructor.");
   return nullptr;
@@ -59,107 +138,185 @@ CSSStyleDeclaration::CSSStyleDeclaration(ExecutingContext* context, int64_t owne
     : ScriptWrappable(context->ctx()), owner_element_target_id_(owner_element_target_id) {}
 
 AtomicString CSSStyleDeclaration::item(const AtomicString& key, ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  return InternalGetPropertyValue(propertyName);
+  return InternalGetPropertyValue(key);
 }
 
 bool CSSStyleDeclaration::SetItem(const AtomicString& key, const AtomicString& value, ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  return InternalSetProperty(propertyName, value);
+  return InternalSetProperty(key, value);
 }
 
 int64_t CSSStyleDeclaration::length() const {
-  return properties_.size();
+  return properties_.size() + custom_properties_.size();
 }
 
 AtomicString CSSStyleDeclaration::getPropertyValue(const AtomicString& key, ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  return InternalGetPropertyValue(propertyName);
+  return InternalGetPropertyValue(key);
 }
 
 void CSSStyleDeclaration::setProperty(const AtomicString& key,
                                       const AtomicString& value,
                                       ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  InternalSetProperty(propertyName, value);
+  InternalSetProperty(key, value);
 }
 
 AtomicString CSSStyleDeclaration::removeProperty(const AtomicString& key, ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  return InternalRemoveProperty(propertyName);
+  return InternalRemoveProperty(key);
 }
 
-void CSSStyleDeclaration::CopyWith(CSSStyleDeclaration* inline_style) {
-  for (auto& attr : inline_style->properties_) {
-    properties_[attr.first] = attr.second;
+AtomicString CSSStyleDeclaration::cssText() const {
+  std::string text;
+  auto append_declaration = [this, &text](const char* name, const AtomicString& value) {
+    if (!text.empty()) {
+      text += ' ';
+    }
+    text += name;
+    text += ": ";
+    text += value.ToStdString(ctx());
+    text += ';';
+  };
+
+  for (auto& property : properties_) {
+    append_declaration(kCSSPropertyIDCSSNames[static_cast<int32_t>(property.first)], property.second);
   }
+  for (auto& property : custom_properties_) {
+    append_declaration(property.first.c_str(), property.second);
+  }
+  return AtomicString(ctx(), text);
 }
 
-std::string CSSStyleDeclaration::ToString() const {
-  if (properties_.empty())
-    return "";
+void CSSStyleDeclaration::setCssText(const AtomicString& value, ExceptionState& exception_state) {
+  std::string text = value.ToStdString(ctx());
+  SetCSSText(text.c_str(), text.length());
+}
 
-  std::string s;
+void CSSStyleDeclaration::SetCSSText(const char* text, size_t length) {
+  std::vector<std::pair<CSSPropertyID, AtomicString>> properties;
+  std::vector<std::pair<std::string, AtomicString>> custom_properties;
+  for (auto& declaration : CSSDeclarationParser::ParseDeclarationList(text, length)) {
+    AtomicString value(ctx(), declaration.value);
+    CSSPropertyID id = CSSPropertyIDFromName(declaration.name.c_str(), declaration.name.length());
+    if (LIKELY(id != CSSPropertyID::kInvalid)) {
+      SetPropertyValue(properties, id, value);
+    } else {
+      SetPropertyValue(custom_properties, parseJavaScriptCSSPropertyName(declaration.name), value);
+    }
+  }
 
-  for (auto& attr : properties_) {
-    s += attr.first + ": " + attr.second.ToStdString(ctx()) + ";";
+  // Send the difference against the current declarations, removed properties are set to empty values.
+  StyleCommandBatch batch;
+  for (auto& property : properties_) {
+    auto it = LowerBound(properties, property.first);
+    if (it == properties.end() || it->first != property.first) {
+      batch.Add(property.first, "");
+    }
+  }
+  for (auto& property : properties) {
+    auto it = LowerBound(properties_, property.first);
+    if (it == properties_.end() || it->first != property.first || it->second != property.second) {
+      batch.Add(property.first, property.second.ToStdString(ctx()));
+    }
+  }
+  for (auto& property : custom_properties_) {
+    if (FindByName(custom_properties, property.first) == custom_properties.end()) {
+      batch.Add(property.first, "");
+    }
+  }
+  for (auto& property : custom_properties) {
+    auto it = FindByName(custom_properties_, property.first);
+    if (it == custom_properties_.end() || it->second != property.second) {
+      batch.Add(property.first, property.second.ToStdString(ctx()));
+    }
   }
 
-  s += "\"";
-  return s;
+  properties_.swap(properties);
+  custom_properties_.swap(custom_properties);
+  batch.Commit(GetExecutingContext(), owner_element_target_id_);
+}
+
+void CSSStyleDeclaration::CopyWith(CSSStyleDeclaration* inline_style) {
+  for (auto& property : inline_style->properties_) {
+    SetPropertyValue(properties_, property.first, property.second);
+  }
+  for (auto& property : inline_style->custom_properties_) {
+    SetPropertyValue(custom_properties_, property.first, property.second);
+  }
 }
 
 bool CSSStyleDeclaration::NamedPropertyQuery(const AtomicString& key, ExceptionState&) {
-  return cssPropertyList.count(key.ToStdString(ctx())) > 0;
+  return PropertyIDFromKey(key) != CSSPropertyID::kInvalid;
 }
 
 void CSSStyleDeclaration::NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState&) {
-  for (auto& entry : cssPropertyList) {
-    names.emplace_back(AtomicString(ctx(), entry.first));
+  names.reserve(names.size() + kCSSPropertyIDCount - 1);
+  for (int32_t id = 1; id < kCSSPropertyIDCount; id++) {
+    names.emplace_back(AtomicString(ctx(), kCSSPropertyIDNames[id]));
   }
 }
 
-AtomicString CSSStyleDeclaration::InternalGetPropertyValue(std::string& name) {
-  name = parseJavaScriptCSSPropertyName(name);
+AtomicString CSSStyleDeclaration::InternalGetPropertyValue(const AtomicString& key) {
+  CSSPropertyID id = PropertyIDFromKey(key);
 
-  if (LIKELY(properties_.count(name) > 0)) {
-    return properties_[name];
+  if (LIKELY(id != CSSPropertyID::kInvalid)) {
+    auto it = LowerBound(properties_, id);
+    if (it != properties_.end() && it->first == id) {
+      return it->second;
+    }
+    return AtomicString::Empty();
   }
 
-  return AtomicString::Empty();
+  auto it = FindByName(custom_properties_, parseJavaScriptCSSPropertyName(key.ToStdString(ctx())));
+  return it != custom_properties_.end() ? it->second : AtomicString::Empty();
 }
 
-bool CSSStyleDeclaration::InternalSetProperty(std::string& name, const AtomicString& value) {
-  name = parseJavaScriptCSSPropertyName(name);
+bool CSSStyleDeclaration::InternalSetProperty(const AtomicString& key, const AtomicString& value) {
+  CSSPropertyID id = PropertyIDFromKey(key);
 
-  if (properties_[name] == value) {
+  if (UNLIKELY(id == CSSPropertyID::kInvalid)) {
+    std::string name = parseJavaScriptCSSPropertyName(key.ToStdString(ctx()));
+    if (!SetPropertyValue(custom_properties_, name, value)) {
+      return true;
+    }
+    GetExecutingContext()->uiCommandBuffer()->addCommand(owner_element_target_id_, UICommand::kSetStyle, name, value,
+                                                         nullptr);
     return true;
   }
 
-  properties_[name] = value;
+  if (!SetPropertyValue(properties_, id, value)) {
+    return true;
+  }
 
-  std::unique_ptr<NativeString> args_01 = stringToNativeString(name);
-  std::unique_ptr<NativeString> args_02 = value.ToNativeString(ctx());
-  GetExecutingContext()->uiCommandBuffer()->addCommand(owner_element_target_id_, UICommand::kSetStyle,
-                                                       std::move(args_01), std::move(args_02), nullptr);
+  GetExecutingContext()->uiCommandBuffer()->addCommand(owner_element_target_id_, UICommand::kSetStyleById, value,
+                                                       PropertyIDPayload(id));
 
   return true;
 }
 
-AtomicString CSSStyleDeclaration::InternalRemoveProperty(std::string& name) {
-  name = parseJavaScriptCSSPropertyName(name);
+AtomicString CSSStyleDeclaration::InternalRemoveProperty(const AtomicString& key) {
+  CSSPropertyID id = PropertyIDFromKey(key);
+
+  if (UNLIKELY(id == CSSPropertyID::kInvalid)) {
+    std::string name = parseJavaScriptCSSPropertyName(key.ToStdString(ctx()));
+    auto it = FindByName(custom_properties_, name);
+    if (it == custom_properties_.end()) {
+      return AtomicString::Empty();
+    }
+    AtomicString return_value = it->second;
+    custom_properties_.erase(it);
+    GetExecutingContext()->uiCommandBuffer()->addCommand(owner_element_target_id_, UICommand::kSetStyle, name,
+                                                         AtomicString::Empty(), nullptr);
+    return return_value;
+  }
 
-  if (UNLIKELY(properties_.count(name) == 0)) {
+  auto it = LowerBound(properties_, id);
+  if (UNLIKELY(it == properties_.end() || it->first != id)) {
     return AtomicString::Empty();
   }
 
-  AtomicString return_value = properties_[name];
-  properties_.erase(name);
+  AtomicString return_value = it->second;
+  properties_.erase(it);
 
-  std::unique_ptr<NativeString> args_01 = stringToNativeString(name);
-  std::unique_ptr<NativeString> args_02 = jsValueToNativeString(ctx(), JS_NULL);
-  GetExecutingContext()->uiCommandBuffer()->addCommand(owner_element_target_id_, UICommand::kSetStyle,
-                                                       std::move(args_01), std::move(args_02), nullptr);
+  GetExecutingContext()->uiCommandBuffer()->addCommand(owner_element_target_id_, UICommand::kSetStyleById,
+                                                       AtomicString::Empty(), PropertyIDPayload(id));
 
   return return_value;
 }
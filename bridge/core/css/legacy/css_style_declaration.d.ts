@@ -1,6 +1,7 @@
 export interface CSSStyleDeclaration {
   // @ts-ignore
   readonly length: int64;
+  cssText: string;
   // @ts-ignore
   getPropertyValue(property: string): string;
   // @ts-ignore
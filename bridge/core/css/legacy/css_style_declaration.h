@@ -5,12 +5,15 @@
 #ifndef BRIDGE_CSS_STYLE_DECLARATION_H
 #define BRIDGE_CSS_STYLE_DECLARATION_H
 
-#include <unordered_map>
+#include <string>
+#include <utility>
+#include <vector>
 #include "bindings/qjs/atomic_string.h"
 #include "bindings/qjs/cppgc/member.h"
 #include "bindings/qjs/exception_state.h"
 #include "bindings/qjs/script_value.h"
 #include "bindings/qjs/script_wrappable.h"
+#include "css_property_ids.h"
 
 namespace webf {
 
@@ -32,18 +35,27 @@ class CSSStyleDeclaration : public ScriptWrappable {
   void setProperty(const AtomicString& key, const AtomicString& value, ExceptionState& exception_state);
   AtomicString removeProperty(const AtomicString& key, ExceptionState& exception_state);
 
+  AtomicString cssText() const;
+  void setCssText(const AtomicString& value, ExceptionState& exception_state);
+  // Replace all the declarations with the parsed |text|, the changes are sent to dart side in one kSetStyles command.
+  void SetCSSText(const char* text, size_t length);
+
   void CopyWith(CSSStyleDeclaration* attributes);
 
-  std::string ToString() const;
+  // Properties known by the code generator, sorted by id.
+  const std::vector<std::pair<CSSPropertyID, AtomicString>>& Properties() const { return properties_; }
+  // Other properties, such as custom properties, keyed by their camelCase names in insertion order.
+  const std::vector<std::pair<std::string, AtomicString>>& CustomProperties() const { return custom_properties_; }
 
   bool NamedPropertyQuery(const AtomicString&, ExceptionState&);
   void NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState&);
 
  private:
-  AtomicString InternalGetPropertyValue(std::string& name);
-  bool InternalSetProperty(std::string& name, const AtomicString& value);
-  AtomicString InternalRemoveProperty(std::string& name);
-  std::unordered_map<std::string, AtomicString> properties_;
+  AtomicString InternalGetPropertyValue(const AtomicString& key);
+  bool InternalSetProperty(const AtomicString& key, const AtomicString& value);
+  AtomicString InternalRemoveProperty(const AtomicString& key);
+  std::vector<std::pair<CSSPropertyID, AtomicString>> properties_;
+  std::vector<std::pair<std::string, AtomicString>> custom_properties_;
   int32_t owner_element_target_id_;
 };
 
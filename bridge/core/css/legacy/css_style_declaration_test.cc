@@ -3,6 +3,8 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 
+#include "css_style_declaration.h"
+#include "core/executing_context.h"
 #include "gtest/gtest.h"
 #include "webf_test_env.h"
 
@@ -37,3 +39,92 @@ TEST(CSSStyleDeclaration, enumerateStyles) {
   bridge->evaluateScript(code, strlen(code), "vm://", 0);
   EXPECT_EQ(errorCalled, false);
 }
+
+TEST(CSSStyleDeclaration, styleCommandsCarryPropertyId) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "red red 2 <div style=\"background-color: red;width: 10px;\"></div>");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  const char* code = "let div = document.createElement('div');";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  context->FlushUICommand();
+  buffer->SetCoalescingEnabled(false);
+
+  const char* style =
+      "div.style.width = '10px';"
+      "div.style.setProperty('background-color', 'red');"
+      "console.log(div.style.backgroundColor, div.style.getPropertyValue('background-color'), div.style.length,"
+      "  div.outerHTML);";
+  bridge->evaluateScript(style, strlen(style), "vm://", 0);
+
+  UICommandItem* items = buffer->data();
+  std::vector<int64_t> property_ids;
+  for (int64_t i = 0; i < buffer->size(); i++) {
+    EXPECT_NE(items[i].type, static_cast<int32_t>(UICommand::kSetStyle));
+    if (items[i].type == static_cast<int32_t>(UICommand::kSetStyleById)) {
+      property_ids.emplace_back(items[i].nativePtr);
+    }
+  }
+  ASSERT_EQ(property_ids.size(), 2);
+  EXPECT_EQ(property_ids[0], static_cast<int64_t>(CSSPropertyID::kWidth));
+  EXPECT_EQ(property_ids[1], static_cast<int64_t>(CSSPropertyID::kBackgroundColor));
+  buffer->clear();
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(CSSStyleDeclaration, cssTextIsAppliedWithOneCommand) {
+  bool static errorCalled = false;
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  const char* code = "let div = document.createElement('div');";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  context->FlushUICommand();
+
+  const char* css_text =
+      "div.style.cssText = 'color: red; background: url(data:image/png;base64,AA==);"
+      "  content: \";\" ; WIDTH: 10px !important; /* width: 0; */ margin';"
+      "console.log(div.style.width, div.style.cssText);";
+  bridge->evaluateScript(css_text, strlen(css_text), "vm://", 0);
+
+  UICommandItem* items = buffer->data();
+  int set_styles = 0;
+  for (int64_t i = 0; i < buffer->size(); i++) {
+    EXPECT_NE(items[i].type, static_cast<int32_t>(UICommand::kSetStyleById));
+    if (items[i].type == static_cast<int32_t>(UICommand::kSetStyles)) {
+      set_styles++;
+    }
+  }
+  EXPECT_EQ(set_styles, 1);
+  buffer->clear();
+
+  const char* attribute =
+      "div.setAttribute('style', 'height: 1px');"
+      "console.log(div.style.width === '', div.getAttribute('style'), div.outerHTML);";
+  bridge->evaluateScript(attribute, strlen(attribute), "vm://", 0);
+  items = buffer->data();
+  ASSERT_EQ(buffer->size(), 1);
+  EXPECT_EQ(items[0].type, static_cast<int32_t>(UICommand::kSetStyles));
+  buffer->clear();
+
+  EXPECT_EQ(errorCalled, false);
+  ASSERT_EQ(logs.size(), 2);
+  EXPECT_EQ(logs[0], "10px background: url(data:image/png;base64,AA==); color: red; content: \";\"; width: 10px;");
+  EXPECT_EQ(logs[1], "true height: 1px <div style=\"height: 1px;\"></div>");
+}
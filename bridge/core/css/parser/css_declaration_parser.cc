@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "css_declaration_parser.h"
+#include <algorithm>
+
+namespace webf {
+
+namespace {
+
+const char kWhitespaces[] = " \t\n\r\f";
+const char kImportant[] = "important";
+const size_t kImportantLength = sizeof(kImportant) - 1;
+
+bool IsWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+bool IsNameChar(char c) {
+  auto u = static_cast<unsigned char>(c);
+  return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9') || u == '_' || u == '-' ||
+         u >= 0x80;
+}
+
+char ToLowerASCII(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 'a' - 'A') : c;
+}
+
+void TrimWhitespace(std::string& string) {
+  size_t end = string.find_last_not_of(kWhitespaces);
+  if (end == std::string::npos) {
+    string.clear();
+    return;
+  }
+  string.erase(end + 1);
+  string.erase(0, string.find_first_not_of(kWhitespaces));
+}
+
+// Remove a trailing "!important", the '!' and the keyword may be separated by whitespace.
+bool StripImportant(std::string& value) {
+  if (value.length() <= kImportantLength)
+    return false;
+  size_t keyword = value.length() - kImportantLength;
+  for (size_t i = 0; i < kImportantLength; i++) {
+    if (ToLowerASCII(value[keyword + i]) != kImportant[i])
+      return false;
+  }
+  size_t bang = value.find_last_not_of(kWhitespaces, keyword - 1);
+  if (bang == std::string::npos || value[bang] != '!')
+    return false;
+  value.erase(bang);
+  TrimWhitespace(value);
+  return true;
+}
+
+}  // namespace
+
+std::vector<CSSParsedDeclaration> CSSDeclarationParser::ParseDeclarationList(const char* text, size_t length) {
+  std::vector<CSSParsedDeclaration> declarations;
+  CSSDeclarationParser parser(text, length);
+  while (!parser.AtEnd()) {
+    CSSParsedDeclaration declaration;
+    if (parser.ConsumeDeclaration(declaration)) {
+      declarations.emplace_back(std::move(declaration));
+    }
+  }
+  return declarations;
+}
+
+bool CSSDeclarationParser::ConsumeDeclaration(CSSParsedDeclaration& declaration) {
+  SkipWhitespaceAndComments();
+  if (AtEnd())
+    return false;
+  if (Peek() == ';') {
+    pos_++;
+    return false;
+  }
+
+  if (!ConsumeName(declaration.name)) {
+    SkipDeclaration();
+    return false;
+  }
+  SkipWhitespaceAndComments();
+  if (AtEnd() || Peek() != ':') {
+    SkipDeclaration();
+    return false;
+  }
+  pos_++;
+
+  ConsumeValue(declaration.value);
+  TrimWhitespace(declaration.value);
+  declaration.important = StripImportant(declaration.value);
+  return !declaration.value.empty();
+}
+
+bool CSSDeclarationParser::ConsumeName(std::string& name) {
+  while (!AtEnd()) {
+    char c = Peek();
+    if (c == '\\') {
+      ConsumeEscape(name);
+    } else if (IsNameChar(c)) {
+      name += c;
+      pos_++;
+    } else {
+      break;
+    }
+  }
+
+  // Property names are ASCII case-insensitive, custom property names are not.
+  if (name.compare(0, 2, "--") != 0) {
+    for (char& c : name) {
+      c = ToLowerASCII(c);
+    }
+  }
+  return !name.empty();
+}
+
+void CSSDeclarationParser::ConsumeValue(std::string& value) {
+  // The closing characters of the open blocks.
+  std::vector<char> blocks;
+  while (!AtEnd()) {
+    char c = Peek();
+    if (c == ';' && blocks.empty()) {
+      pos_++;
+      return;
+    }
+
+    if (c == '/' && Peek(1) == '*') {
+      SkipComment();
+      // A comment separates tokens.
+      if (!value.empty() && !IsWhitespace(value.back())) {
+        value += ' ';
+      }
+      continue;
+    }
+    if (c == '"' || c == '\'') {
+      ConsumeString(value);
+      continue;
+    }
+    if (c == '\\') {
+      ConsumeEscape(value);
+      continue;
+    }
+
+    if (c == '(') {
+      blocks.push_back(')');
+    } else if (c == '[') {
+      blocks.push_back(']');
+    } else if (c == '{') {
+      blocks.push_back('}');
+    } else if (!blocks.empty() && c == blocks.back()) {
+      blocks.pop_back();
+    }
+
+    if (c == '\0') {
+      // U+0000 is replaced by U+FFFD in CSS.
+      value += "\xEF\xBF\xBD";
+    } else {
+      value += c;
+    }
+    pos_++;
+  }
+}
+
+void CSSDeclarationParser::ConsumeString(std::string& output) {
+  char quote = Peek();
+  output += quote;
+  pos_++;
+  while (!AtEnd()) {
+    char c = Peek();
+    if (c == quote) {
+      output += c;
+      pos_++;
+      return;
+    }
+    // An unescaped newline ends a bad string, the newline itself belongs to the value.
+    if (c == '\n')
+      return;
+    if (c == '\\') {
+      ConsumeEscape(output);
+      continue;
+    }
+    output += c;
+    pos_++;
+  }
+}
+
+void CSSDeclarationParser::ConsumeEscape(std::string& output) {
+  // Keep escapes as they are, dart side decodes them together with the rest of the value.
+  output += Peek();
+  pos_++;
+  if (!AtEnd()) {
+    output += Peek();
+    pos_++;
+  }
+}
+
+void CSSDeclarationParser::SkipDeclaration() {
+  std::string ignored;
+  ConsumeValue(ignored);
+}
+
+bool CSSDeclarationParser::SkipComment() {
+  if (Peek() != '/' || Peek(1) != '*')
+    return false;
+  pos_ += 2;
+  while (!AtEnd() && !(Peek() == '*' && Peek(1) == '/')) {
+    pos_++;
+  }
+  pos_ = std::min(pos_ + 2, length_);
+  return true;
+}
+
+void CSSDeclarationParser::SkipWhitespaceAndComments() {
+  while (!AtEnd()) {
+    if (IsWhitespace(Peek())) {
+      pos_++;
+    } else if (!SkipComment()) {
+      return;
+    }
+  }
+}
+
+}  // namespace webf
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_CSS_PARSER_CSS_DECLARATION_PARSER_H_
+#define BRIDGE_CORE_CSS_PARSER_CSS_DECLARATION_PARSER_H_
+
+#include <string>
+#include <vector>
+
+namespace webf {
+
+struct CSSParsedDeclaration {
+  // Lower cased, except for custom properties.
+  std::string name;
+  // Without the surrounding whitespace and the !important flag.
+  std::string value;
+  bool important{false};
+};
+
+// Parse a list of declarations, e.g. the content of a style attribute or cssText, with the error recovery of CSS
+// Syntax: strings, escapes, comments and (), [] and {} blocks are consumed as a whole when looking for the ';' and ':'
+// delimiters, so url(data:image/png;base64,...) or content: ";" stay in one value. Declarations without a name, a ':'
+// or a value are dropped. Values are not validated, dart side parses them.
+class CSSDeclarationParser {
+ public:
+  static std::vector<CSSParsedDeclaration> ParseDeclarationList(const char* text, size_t length);
+
+ private:
+  CSSDeclarationParser(const char* text, size_t length) : text_(text), length_(length) {}
+
+  bool ConsumeDeclaration(CSSParsedDeclaration& declaration);
+  bool ConsumeName(std::string& name);
+  void ConsumeValue(std::string& value);
+  void ConsumeString(std::string& output);
+  void ConsumeEscape(std::string& output);
+  // Skip the rest of an invalid declaration, including the ';'.
+  void SkipDeclaration();
+  bool SkipComment();
+  void SkipWhitespaceAndComments();
+
+  bool AtEnd() const { return pos_ >= length_; }
+  char Peek(size_t offset = 0) const { return pos_ + offset < length_ ? text_[pos_ + offset] : '\0'; }
+
+  const char* text_;
+  size_t length_;
+  size_t pos_{0};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_CSS_PARSER_CSS_DECLARATION_PARSER_H_
@@ -0,0 +1,523 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "css_selector_parser.h"
+#include <algorithm>
+#include <climits>
+
+namespace webf {
+
+namespace {
+
+// Nested :not() / :is() deeper than this are rejected, to keep the recursion of parser and matcher bounded.
+const int kMaxNestingDepth = 32;
+
+bool IsWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+std::string Trim(const std::string& string) {
+  size_t start = 0;
+  size_t end = string.length();
+  while (start < end && IsWhitespace(string[start]))
+    start++;
+  while (end > start && IsWhitespace(string[end - 1]))
+    end--;
+  return string.substr(start, end - start);
+}
+
+bool IsHexDigit(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool IsNameStart(char c) {
+  auto u = static_cast<unsigned char>(c);
+  return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || u == '_' || u >= 0x80;
+}
+
+bool IsNameChar(char c) {
+  return IsNameStart(c) || (c >= '0' && c <= '9') || c == '-';
+}
+
+std::string ToLowerASCII(std::string string) {
+  std::transform(string.begin(), string.end(), string.begin(),
+                 [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 'a' - 'A') : c; });
+  return string;
+}
+
+std::string ToUpperASCII(std::string string) {
+  std::transform(string.begin(), string.end(), string.begin(),
+                 [](char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c; });
+  return string;
+}
+
+void AppendCodePoint(std::string& output, uint32_t code_point) {
+  if (code_point == 0 || code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF))
+    code_point = 0xFFFD;
+  if (code_point < 0x80) {
+    output += static_cast<char>(code_point);
+  } else if (code_point < 0x800) {
+    output += static_cast<char>(0xC0 | (code_point >> 6));
+    output += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else if (code_point < 0x10000) {
+    output += static_cast<char>(0xE0 | (code_point >> 12));
+    output += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    output += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else {
+    output += static_cast<char>(0xF0 | (code_point >> 18));
+    output += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    output += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    output += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+}
+
+// [+-]?[0-9]+, the whole string must be consumed.
+bool ParseInteger(const std::string& string, int* value) {
+  size_t i = 0;
+  bool negative = false;
+  if (i < string.length() && (string[i] == '+' || string[i] == '-')) {
+    negative = string[i] == '-';
+    i++;
+  }
+  if (i == string.length())
+    return false;
+  int64_t result = 0;
+  for (; i < string.length(); i++) {
+    if (string[i] < '0' || string[i] > '9')
+      return false;
+    result = std::min<int64_t>(result * 10 + (string[i] - '0'), INT_MAX);
+  }
+  *value = static_cast<int>(negative ? -result : result);
+  return true;
+}
+
+}  // namespace
+
+std::unique_ptr<CSSSelectorList> CSSSelectorParser::ParseSelectorList(JSContext* ctx,
+                                                                      const std::string& selectors,
+                                                                      ParseResult* result) {
+  CSSSelectorParser parser(ctx, selectors);
+  std::vector<ComplexSelector> list;
+  parser.SkipWhitespace();
+  if (!parser.ConsumeSelectorList(list, false)) {
+    *result = parser.result_;
+    return nullptr;
+  }
+  *result = ParseResult::kValid;
+  return std::make_unique<CSSSelectorList>(std::move(list));
+}
+
+bool CSSSelectorParser::ConsumeSelectorList(std::vector<ComplexSelector>& selectors, bool nested) {
+  while (true) {
+    ComplexSelector selector;
+    if (!ConsumeComplexSelector(selector))
+      return false;
+    selectors.emplace_back(std::move(selector));
+
+    SkipWhitespace();
+    if (AtEnd() || (nested && Peek() == ')'))
+      return true;
+    if (Peek() != ',')
+      return Fail(ParseResult::kInvalid);
+    pos_++;
+    SkipWhitespace();
+  }
+}
+
+bool CSSSelectorParser::ConsumeComplexSelector(ComplexSelector& selector) {
+  std::vector<std::vector<CSSSelector>> compounds;
+  std::vector<CSSSelector::RelationType> combinators;
+
+  compounds.emplace_back();
+  if (!ConsumeCompoundSelector(compounds.back()))
+    return false;
+
+  while (true) {
+    bool has_whitespace = SkipWhitespace();
+    if (AtEnd() || Peek() == ',' || Peek() == ')')
+      break;
+
+    CSSSelector::RelationType relation;
+    switch (Peek()) {
+      case '>':
+        relation = CSSSelector::kChild;
+        break;
+      case '+':
+        relation = CSSSelector::kDirectAdjacent;
+        break;
+      case '~':
+        relation = CSSSelector::kIndirectAdjacent;
+        break;
+      default:
+        if (!has_whitespace)
+          return Fail(ParseResult::kInvalid);
+        relation = CSSSelector::kDescendant;
+        break;
+    }
+    if (relation != CSSSelector::kDescendant) {
+      pos_++;
+      SkipWhitespace();
+    }
+
+    combinators.emplace_back(relation);
+    compounds.emplace_back();
+    if (!ConsumeCompoundSelector(compounds.back()))
+      return false;
+  }
+
+  // Store from right to left, the last simple selector of each compound holds the combinator on its left.
+  for (size_t i = compounds.size(); i-- > 0;) {
+    if (i > 0)
+      compounds[i].back().relation_ = combinators[i - 1];
+    for (auto& simple : compounds[i]) {
+      selector.emplace_back(std::move(simple));
+    }
+  }
+  return true;
+}
+
+bool CSSSelectorParser::ConsumeCompoundSelector(std::vector<CSSSelector>& compound) {
+  if (Peek() == '*') {
+    pos_++;
+    compound.emplace_back(CSSSelector::kUniversal);
+  } else if (IsIdentStart()) {
+    std::string name;
+    ConsumeIdent(name);
+    CSSSelector selector(CSSSelector::kTag);
+    selector.value_ = AtomicString(ctx_, ToLowerASCII(name));
+    selector.upper_value_ = AtomicString(ctx_, ToUpperASCII(name));
+    compound.emplace_back(std::move(selector));
+  }
+
+  if (Peek() == '|')
+    return Fail(ParseResult::kUnsupported);
+
+  while (!AtEnd()) {
+    char c = Peek();
+    if (c == '#' || c == '.') {
+      pos_++;
+      std::string name;
+      if (!ConsumeIdent(name))
+        return Fail(ParseResult::kInvalid);
+      CSSSelector selector(c == '#' ? CSSSelector::kId : CSSSelector::kClass);
+      selector.value_ = AtomicString(ctx_, name);
+      compound.emplace_back(std::move(selector));
+    } else if (c == '[') {
+      if (!ConsumeAttributeSelector(compound))
+        return false;
+    } else if (c == ':') {
+      if (!ConsumePseudoClass(compound))
+        return false;
+    } else {
+      break;
+    }
+  }
+
+  if (compound.empty())
+    return Fail(ParseResult::kInvalid);
+  return true;
+}
+
+bool CSSSelectorParser::ConsumeAttributeSelector(std::vector<CSSSelector>& compound) {
+  pos_++;  // [
+  SkipWhitespace();
+  std::string name;
+  if (!ConsumeIdent(name))
+    return Fail(Peek() == '|' || Peek() == '*' ? ParseResult::kUnsupported : ParseResult::kInvalid);
+  // Attribute names of HTML elements are matched ASCII case-insensitively, and the parser stores them in lower case.
+  name = ToLowerASCII(name);
+  SkipWhitespace();
+
+  if (Peek() == ']') {
+    pos_++;
+    CSSSelector selector(CSSSelector::kAttributeSet);
+    selector.attribute_ = AtomicString(ctx_, name);
+    compound.emplace_back(std::move(selector));
+    return true;
+  }
+
+  CSSSelector::MatchType match;
+  switch (Peek()) {
+    case '=':
+      match = CSSSelector::kAttributeExact;
+      break;
+    case '~':
+      match = CSSSelector::kAttributeList;
+      break;
+    case '|':
+      // [ns|attr] selects an attribute in a namespace.
+      if (Peek(1) != '=')
+        return Fail(ParseResult::kUnsupported);
+      match = CSSSelector::kAttributeHyphen;
+      break;
+    case '^':
+      match = CSSSelector::kAttributeBegin;
+      break;
+    case '$':
+      match = CSSSelector::kAttributeEnd;
+      break;
+    case '*':
+      match = CSSSelector::kAttributeContain;
+      break;
+    default:
+      return Fail(ParseResult::kInvalid);
+  }
+  pos_++;
+  if (match != CSSSelector::kAttributeExact) {
+    if (Peek() != '=')
+      return Fail(ParseResult::kInvalid);
+    pos_++;
+  }
+  SkipWhitespace();
+
+  std::string value;
+  if (Peek() == '"' || Peek() == '\'') {
+    if (!ConsumeString(value))
+      return Fail(ParseResult::kInvalid);
+  } else if (!ConsumeIdent(value)) {
+    return Fail(ParseResult::kInvalid);
+  }
+  SkipWhitespace();
+
+  CSSSelector selector(match);
+  if (Peek() != ']') {
+    std::string flag;
+    if (!ConsumeIdent(flag))
+      return Fail(ParseResult::kInvalid);
+    flag = ToLowerASCII(flag);
+    if (flag == "i") {
+      selector.attribute_match_ = CSSSelector::kCaseInsensitive;
+    } else if (flag != "s") {
+      return Fail(ParseResult::kInvalid);
+    }
+    SkipWhitespace();
+    if (Peek() != ']')
+      return Fail(ParseResult::kInvalid);
+  }
+  pos_++;  // ]
+
+  selector.attribute_ = AtomicString(ctx_, name);
+  selector.value_ = AtomicString(ctx_, value);
+  selector.value_string_ =
+      selector.attribute_match_ == CSSSelector::kCaseInsensitive ? ToLowerASCII(value) : std::move(value);
+  compound.emplace_back(std::move(selector));
+  return true;
+}
+
+bool CSSSelectorParser::ConsumePseudoClass(std::vector<CSSSelector>& compound) {
+  pos_++;  // :
+  // Pseudo elements never match an element in the tree.
+  if (Peek() == ':')
+    return Fail(ParseResult::kUnsupported);
+
+  std::string name;
+  if (!ConsumeIdent(name))
+    return Fail(ParseResult::kInvalid);
+  name = ToLowerASCII(name);
+
+  CSSSelector selector(CSSSelector::kPseudoClass);
+  if (Peek() != '(') {
+    if (name == "root") {
+      selector.pseudo_type_ = CSSSelector::kPseudoRoot;
+    } else if (name == "scope") {
+      selector.pseudo_type_ = CSSSelector::kPseudoScope;
+    } else if (name == "empty") {
+      selector.pseudo_type_ = CSSSelector::kPseudoEmpty;
+    } else if (name == "first-child") {
+      selector.pseudo_type_ = CSSSelector::kPseudoFirstChild;
+    } else if (name == "last-child") {
+      selector.pseudo_type_ = CSSSelector::kPseudoLastChild;
+    } else if (name == "only-child") {
+      selector.pseudo_type_ = CSSSelector::kPseudoOnlyChild;
+    } else if (name == "first-of-type") {
+      selector.pseudo_type_ = CSSSelector::kPseudoFirstOfType;
+    } else if (name == "last-of-type") {
+      selector.pseudo_type_ = CSSSelector::kPseudoLastOfType;
+    } else if (name == "only-of-type") {
+      selector.pseudo_type_ = CSSSelector::kPseudoOnlyOfType;
+    } else {
+      return Fail(ParseResult::kUnsupported);
+    }
+    compound.emplace_back(std::move(selector));
+    return true;
+  }
+
+  pos_++;  // (
+  SkipWhitespace();
+  if (name == "nth-child" || name == "nth-last-child" || name == "nth-of-type" || name == "nth-last-of-type") {
+    if (name == "nth-child") {
+      selector.pseudo_type_ = CSSSelector::kPseudoNthChild;
+    } else if (name == "nth-last-child") {
+      selector.pseudo_type_ = CSSSelector::kPseudoNthLastChild;
+    } else if (name == "nth-of-type") {
+      selector.pseudo_type_ = CSSSelector::kPseudoNthOfType;
+    } else {
+      selector.pseudo_type_ = CSSSelector::kPseudoNthLastOfType;
+    }
+    if (!ConsumeNth(selector))
+      return false;
+  } else if (name == "not" || name == "is" || name == "where") {
+    if (++depth_ > kMaxNestingDepth)
+      return Fail(ParseResult::kInvalid);
+    selector.pseudo_type_ = name == "not" ? CSSSelector::kPseudoNot : CSSSelector::kPseudoIs;
+    std::vector<ComplexSelector> list;
+    if (!ConsumeSelectorList(list, true))
+      return false;
+    depth_--;
+    selector.selector_list_ = std::make_unique<CSSSelectorList>(std::move(list));
+  } else {
+    return Fail(ParseResult::kUnsupported);
+  }
+
+  SkipWhitespace();
+  if (Peek() != ')')
+    return Fail(ParseResult::kInvalid);
+  pos_++;
+  compound.emplace_back(std::move(selector));
+  return true;
+}
+
+// https://drafts.csswg.org/css-syntax-3/#anb-microsyntax
+bool CSSSelectorParser::ConsumeNth(CSSSelector& selector) {
+  std::string expression;
+  while (!AtEnd() && Peek() != ')') {
+    expression += Peek();
+    pos_++;
+  }
+  expression = ToLowerASCII(Trim(expression));
+
+  if (expression == "odd") {
+    selector.nth_a_ = 2;
+    selector.nth_b_ = 1;
+    return true;
+  }
+  if (expression == "even") {
+    selector.nth_a_ = 2;
+    selector.nth_b_ = 0;
+    return true;
+  }
+  // The "of S" syntax of selectors level 4.
+  if (expression.find("of") != std::string::npos)
+    return Fail(ParseResult::kUnsupported);
+
+  size_t n = expression.find('n');
+  if (n == std::string::npos) {
+    selector.nth_a_ = 0;
+    return ParseInteger(expression, &selector.nth_b_) || Fail(ParseResult::kInvalid);
+  }
+
+  // Whitespace is only allowed on both sides of the sign of b, e.g. "2n + 1", not in "2 n" or "2n+ 1 0".
+  std::string a = expression.substr(0, n);
+  std::string b = Trim(expression.substr(n + 1));
+  if (!b.empty() && (b[0] == '+' || b[0] == '-'))
+    b = b[0] + Trim(b.substr(1));
+  if (a.empty() || a == "+") {
+    selector.nth_a_ = 1;
+  } else if (a == "-") {
+    selector.nth_a_ = -1;
+  } else if (!ParseInteger(a, &selector.nth_a_)) {
+    return Fail(ParseResult::kInvalid);
+  }
+
+  if (b.empty()) {
+    selector.nth_b_ = 0;
+    return true;
+  }
+  if ((b[0] != '+' && b[0] != '-') || !ParseInteger(b, &selector.nth_b_))
+    return Fail(ParseResult::kInvalid);
+  return true;
+}
+
+bool CSSSelectorParser::IsIdentStart() const {
+  char c = Peek();
+  if (IsNameStart(c))
+    return true;
+  if (c == '\\')
+    return Peek(1) != '\n' && Peek(1) != '\0';
+  if (c == '-') {
+    char next = Peek(1);
+    return IsNameStart(next) || next == '-' || (next == '\\' && Peek(2) != '\n' && Peek(2) != '\0');
+  }
+  return false;
+}
+
+bool CSSSelectorParser::ConsumeIdent(std::string& ident) {
+  if (!IsIdentStart())
+    return false;
+  while (!AtEnd()) {
+    char c = Peek();
+    if (IsNameChar(c)) {
+      ident += c;
+      pos_++;
+    } else if (c == '\\' && Peek(1) != '\n' && Peek(1) != '\0') {
+      ConsumeEscape(ident);
+    } else {
+      break;
+    }
+  }
+  return true;
+}
+
+bool CSSSelectorParser::ConsumeString(std::string& string) {
+  char quote = Peek();
+  pos_++;
+  while (!AtEnd()) {
+    char c = Peek();
+    if (c == quote) {
+      pos_++;
+      return true;
+    }
+    if (c == '\n')
+      return false;
+    if (c == '\\') {
+      if (Peek(1) == '\n') {
+        pos_ += 2;
+      } else if (Peek(1) == '\0') {
+        pos_++;
+      } else {
+        ConsumeEscape(string);
+      }
+      continue;
+    }
+    string += c;
+    pos_++;
+  }
+  // EOF terminates the string.
+  return true;
+}
+
+// https://drafts.csswg.org/css-syntax-3/#consume-escaped-code-point
+void CSSSelectorParser::ConsumeEscape(std::string& output) {
+  pos_++;  // Backslash
+  if (!IsHexDigit(Peek())) {
+    output += Peek();
+    pos_++;
+    return;
+  }
+  uint32_t code_point = 0;
+  for (int i = 0; i < 6 && IsHexDigit(Peek()); i++) {
+    char c = Peek();
+    code_point = code_point * 16 + (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+    pos_++;
+  }
+  if (IsWhitespace(Peek()))
+    pos_++;
+  AppendCodePoint(output, code_point);
+}
+
+bool CSSSelectorParser::SkipWhitespace() {
+  size_t start = pos_;
+  while (!AtEnd() && IsWhitespace(Peek())) {
+    pos_++;
+  }
+  return pos_ != start;
+}
+
+bool CSSSelectorParser::Fail(ParseResult result) {
+  if (result_ != ParseResult::kInvalid)
+    result_ = result;
+  return false;
+}
+
+}  // namespace webf
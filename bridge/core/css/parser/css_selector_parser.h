@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_CSS_PARSER_CSS_SELECTOR_PARSER_H_
+#define BRIDGE_CORE_CSS_PARSER_CSS_SELECTOR_PARSER_H_
+
+#include <quickjs/quickjs.h>
+#include <memory>
+#include <string>
+#include "core/css/css_selector.h"
+
+namespace webf {
+
+// Parse selectors for querySelector(), matches() and closest().
+//
+// Supports type, universal, id, class and attribute selectors, all combinators, and the tree-structural pseudo
+// classes together with :not(), :is() and :where(). Namespaces, pseudo elements and pseudo classes which depend on
+// user interaction or rendering state (e.g. :hover) are reported as kUnsupported, callers should fall back to dart
+// side for them.
+class CSSSelectorParser {
+ public:
+  enum class ParseResult { kValid, kInvalid, kUnsupported };
+
+  // Returns nullptr when |selectors| is invalid or unsupported, the reason is written to |result|.
+  static std::unique_ptr<CSSSelectorList> ParseSelectorList(JSContext* ctx,
+                                                            const std::string& selectors,
+                                                            ParseResult* result);
+
+ private:
+  using ComplexSelector = CSSSelectorList::ComplexSelector;
+
+  CSSSelectorParser(JSContext* ctx, const std::string& input) : ctx_(ctx), input_(input) {}
+
+  bool ConsumeSelectorList(std::vector<ComplexSelector>& selectors, bool nested);
+  bool ConsumeComplexSelector(ComplexSelector& selector);
+  bool ConsumeCompoundSelector(std::vector<CSSSelector>& compound);
+  bool ConsumeAttributeSelector(std::vector<CSSSelector>& compound);
+  bool ConsumePseudoClass(std::vector<CSSSelector>& compound);
+  bool ConsumeNth(CSSSelector& selector);
+
+  bool ConsumeIdent(std::string& ident);
+  bool ConsumeString(std::string& string);
+  void ConsumeEscape(std::string& output);
+  bool SkipWhitespace();
+
+  bool AtEnd() const { return pos_ >= input_.length(); }
+  char Peek(size_t offset = 0) const { return pos_ + offset < input_.length() ? input_[pos_ + offset] : '\0'; }
+  bool IsIdentStart() const;
+
+  bool Fail(ParseResult result);
+
+  JSContext* ctx_;
+  const std::string& input_;
+  size_t pos_{0};
+  int depth_{0};
+  ParseResult result_{ParseResult::kValid};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_CSS_PARSER_CSS_SELECTOR_PARSER_H_
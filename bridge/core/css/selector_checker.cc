@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "selector_checker.h"
+#include <algorithm>
+#include "core/dom/element.h"
+#include "core/dom/element_traversal.h"
+#include "core/dom/text.h"
+
+namespace webf {
+
+namespace {
+
+bool IsHTMLSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+std::string ToLowerASCII(std::string string) {
+  std::transform(string.begin(), string.end(), string.begin(),
+                 [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 'a' - 'A') : c; });
+  return string;
+}
+
+bool ContainsToken(const std::string& list, const std::string& token) {
+  if (token.empty() || std::any_of(token.begin(), token.end(), IsHTMLSpace))
+    return false;
+  size_t start = 0;
+  while (start < list.length()) {
+    while (start < list.length() && IsHTMLSpace(list[start])) {
+      start++;
+    }
+    size_t end = start;
+    while (end < list.length() && !IsHTMLSpace(list[end])) {
+      end++;
+    }
+    if (end - start == token.length() && list.compare(start, token.length(), token) == 0)
+      return true;
+    start = end;
+  }
+  return false;
+}
+
+bool IsRootElement(const Element& element) {
+  ContainerNode* parent = element.parentNode();
+  return parent != nullptr && parent->IsDocumentNode();
+}
+
+bool IsEmptyElement(const Element& element) {
+  for (Node* child = element.firstChild(); child != nullptr; child = child->nextSibling()) {
+    if (child->IsElementNode())
+      return false;
+    if (auto* text = DynamicTo<Text>(child)) {
+      if (!text->data().IsEmpty())
+        return false;
+    }
+  }
+  return true;
+}
+
+// Number of element siblings before |element|, plus one. Only siblings with the same tag are counted if |of_type|.
+int NthIndex(const Element& element, bool of_type) {
+  int index = 1;
+  for (Element* sibling = ElementTraversal::PreviousSibling(element); sibling != nullptr;
+       sibling = ElementTraversal::PreviousSibling(*sibling)) {
+    if (!of_type || sibling->HasTagName(element.LocalName()))
+      index++;
+  }
+  return index;
+}
+
+int NthLastIndex(const Element& element, bool of_type) {
+  int index = 1;
+  for (Element* sibling = ElementTraversal::NextSibling(element); sibling != nullptr;
+       sibling = ElementTraversal::NextSibling(*sibling)) {
+    if (!of_type || sibling->HasTagName(element.LocalName()))
+      index++;
+  }
+  return index;
+}
+
+}  // namespace
+
+bool SelectorChecker::Match(const CSSSelectorList& selector_list, Element& element, const ContainerNode* scope) {
+  for (auto& selector : selector_list.Selectors()) {
+    if (Match(selector, element, scope))
+      return true;
+  }
+  return false;
+}
+
+bool SelectorChecker::Match(const CSSSelectorList::ComplexSelector& selector,
+                            Element& element,
+                            const ContainerNode* scope) {
+  return MatchSelector(selector.data(), selector.data() + selector.size(), element, scope);
+}
+
+bool SelectorChecker::MatchSelector(const CSSSelector* selector,
+                                    const CSSSelector* end,
+                                    Element& element,
+                                    const ContainerNode* scope) {
+  // Match the compound selector at |selector|, which ends at the first simple selector holding a combinator.
+  const CSSSelector* current = selector;
+  while (true) {
+    if (!MatchSimpleSelector(*current, element, scope))
+      return false;
+    if (current + 1 == end)
+      return true;
+    if (current->Relation() != CSSSelector::kSubSelector)
+      break;
+    current++;
+  }
+
+  const CSSSelector* next = current + 1;
+  switch (current->Relation()) {
+    case CSSSelector::kDescendant:
+      for (Element* ancestor = element.parentElement(); ancestor != nullptr; ancestor = ancestor->parentElement()) {
+        if (MatchSelector(next, end, *ancestor, scope))
+          return true;
+      }
+      return false;
+    case CSSSelector::kChild: {
+      Element* parent = element.parentElement();
+      return parent != nullptr && MatchSelector(next, end, *parent, scope);
+    }
+    case CSSSelector::kDirectAdjacent: {
+      Element* previous = ElementTraversal::PreviousSibling(element);
+      return previous != nullptr && MatchSelector(next, end, *previous, scope);
+    }
+    case CSSSelector::kIndirectAdjacent:
+      for (Element* previous = ElementTraversal::PreviousSibling(element); previous != nullptr;
+           previous = ElementTraversal::PreviousSibling(*previous)) {
+        if (MatchSelector(next, end, *previous, scope))
+          return true;
+      }
+      return false;
+    case CSSSelector::kSubSelector:
+      break;
+  }
+  return false;
+}
+
+bool SelectorChecker::MatchSimpleSelector(const CSSSelector& selector, Element& element, const ContainerNode* scope) {
+  switch (selector.Match()) {
+    case CSSSelector::kUniversal:
+      return true;
+    case CSSSelector::kTag:
+      return element.HasTagName(selector.Value()) || element.HasTagName(selector.UpperValue());
+    case CSSSelector::kId:
+      return element.GetIdAttribute() == selector.Value();
+    case CSSSelector::kClass:
+      return element.HasClass(selector.Value());
+    case CSSSelector::kPseudoClass:
+      return MatchPseudoClass(selector, element, scope);
+    default:
+      return MatchAttribute(selector, element);
+  }
+}
+
+bool SelectorChecker::MatchAttribute(const CSSSelector& selector, const Element& element) {
+  const AtomicString* attribute = element.FastGetAttribute(selector.Attribute());
+  if (attribute == nullptr)
+    return false;
+  if (selector.Match() == CSSSelector::kAttributeSet)
+    return true;
+  if (selector.Match() == CSSSelector::kAttributeExact && selector.AttributeMatch() == CSSSelector::kCaseSensitive)
+    return *attribute == selector.Value();
+
+  std::string value = attribute->ToStdString(element.ctx());
+  if (selector.AttributeMatch() == CSSSelector::kCaseInsensitive)
+    value = ToLowerASCII(value);
+  const std::string& expected = selector.ValueString();
+
+  switch (selector.Match()) {
+    case CSSSelector::kAttributeExact:
+      return value == expected;
+    case CSSSelector::kAttributeList:
+      return ContainsToken(value, expected);
+    case CSSSelector::kAttributeHyphen:
+      return value.compare(0, expected.length(), expected) == 0 &&
+             (value.length() == expected.length() || value[expected.length()] == '-');
+    case CSSSelector::kAttributeBegin:
+      return !expected.empty() && value.compare(0, expected.length(), expected) == 0;
+    case CSSSelector::kAttributeEnd:
+      return !expected.empty() && value.length() >= expected.length() &&
+             value.compare(value.length() - expected.length(), expected.length(), expected) == 0;
+    case CSSSelector::kAttributeContain:
+      return !expected.empty() && value.find(expected) != std::string::npos;
+    default:
+      return false;
+  }
+}
+
+bool SelectorChecker::MatchPseudoClass(const CSSSelector& selector, Element& element, const ContainerNode* scope) {
+  switch (selector.GetPseudoType()) {
+    case CSSSelector::kPseudoRoot:
+      return IsRootElement(element);
+    case CSSSelector::kPseudoScope:
+      if (scope == nullptr || scope->IsDocumentNode())
+        return IsRootElement(element);
+      return scope == &element;
+    case CSSSelector::kPseudoEmpty:
+      return IsEmptyElement(element);
+    case CSSSelector::kPseudoFirstChild:
+      return ElementTraversal::PreviousSibling(element) == nullptr;
+    case CSSSelector::kPseudoLastChild:
+      return ElementTraversal::NextSibling(element) == nullptr;
+    case CSSSelector::kPseudoOnlyChild:
+      return ElementTraversal::PreviousSibling(element) == nullptr &&
+             ElementTraversal::NextSibling(element) == nullptr;
+    case CSSSelector::kPseudoFirstOfType:
+      return NthIndex(element, true) == 1;
+    case CSSSelector::kPseudoLastOfType:
+      return NthLastIndex(element, true) == 1;
+    case CSSSelector::kPseudoOnlyOfType:
+      return NthIndex(element, true) == 1 && NthLastIndex(element, true) == 1;
+    case CSSSelector::kPseudoNthChild:
+      return selector.MatchNth(NthIndex(element, false));
+    case CSSSelector::kPseudoNthLastChild:
+      return selector.MatchNth(NthLastIndex(element, false));
+    case CSSSelector::kPseudoNthOfType:
+      return selector.MatchNth(NthIndex(element, true));
+    case CSSSelector::kPseudoNthLastOfType:
+      return selector.MatchNth(NthLastIndex(element, true));
+    case CSSSelector::kPseudoNot:
+      return !Match(*selector.SelectorList(), element, scope);
+    case CSSSelector::kPseudoIs:
+      return Match(*selector.SelectorList(), element, scope);
+    case CSSSelector::kPseudoUnknown:
+      break;
+  }
+  return false;
+}
+
+}  // namespace webf
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_CSS_SELECTOR_CHECKER_H_
+#define BRIDGE_CORE_CSS_SELECTOR_CHECKER_H_
+
+#include "core/css/css_selector.h"
+#include "foundation/macros.h"
+
+namespace webf {
+
+class ContainerNode;
+class Element;
+
+// Match compiled selectors against the native DOM tree.
+//
+// |scope| is the node matched by :scope, it's the element which querySelector(), matches() or closest() is called
+// on. When the scope is the document (or nullptr), :scope matches the root element like :root.
+class SelectorChecker {
+  WEBF_STATIC_ONLY(SelectorChecker);
+
+ public:
+  static bool Match(const CSSSelectorList& selector_list, Element& element, const ContainerNode* scope);
+  static bool Match(const CSSSelectorList::ComplexSelector& selector, Element& element, const ContainerNode* scope);
+
+ private:
+  static bool MatchSelector(const CSSSelector* selector,
+                            const CSSSelector* end,
+                            Element& element,
+                            const ContainerNode* scope);
+  static bool MatchSimpleSelector(const CSSSelector& selector, Element& element, const ContainerNode* scope);
+  static bool MatchAttribute(const CSSSelector& selector, const Element& element);
+  static bool MatchPseudoClass(const CSSSelector& selector, Element& element, const ContainerNode* scope);
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_CSS_SELECTOR_CHECKER_H_
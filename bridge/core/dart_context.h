@@ -8,6 +8,7 @@
 #include <set>
 #include "dart_context_data.h"
 #include "dart_methods.h"
+#include "page_pool.h"
 
 namespace webf {
 
@@ -24,6 +25,7 @@ class DartContext {
   void AddNewPage(WebFPage* new_page);
   void RemovePage(WebFPage* page);
   const std::unique_ptr<DartContextData>& EnsureData() const;
+  FORCE_INLINE PagePool* pagePool() const { return page_pool_.get(); }
 
   FORCE_INLINE JSRuntime* runtime() const { return runtime_; }
   FORCE_INLINE const std::unique_ptr<DartMethodPointer>& dartMethodPtr() const { return dart_method_ptr_; }
@@ -38,6 +40,7 @@ class DartContext {
   const std::unique_ptr<DartMethodPointer> dart_method_ptr_ = nullptr;
   mutable std::unique_ptr<DartContextData> data_;
   std::set<WebFPage*> pages_;
+  std::unique_ptr<PagePool> page_pool_ = std::make_unique<PagePool>(this);
 };
 
 }  // namespace webf
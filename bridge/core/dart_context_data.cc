@@ -3,6 +3,7 @@
  */
 
 #include "dart_context_data.h"
+#include <utility>
 
 namespace webf {
 
@@ -18,4 +19,29 @@ void DartContextData::SetWidgetElementShape(const AtomicString& key, const std::
   widget_element_shapes_[key] = shape;
 }
 
-}  // namespace webf
\ No newline at end of file
+const std::unordered_set<AtomicString, AtomicString::KeyHasher>* DartContextData::GetDartComputedAttributes(
+    const AtomicString& tag_name) const {
+  auto it = dart_computed_attributes_.find(tag_name);
+  return it != dart_computed_attributes_.end() ? &it->second : nullptr;
+}
+
+void DartContextData::SetDartComputedAttributes(const AtomicString& tag_name,
+                                                std::unordered_set<AtomicString, AtomicString::KeyHasher> attributes) {
+  dart_computed_attributes_[tag_name] = std::move(attributes);
+}
+
+const std::vector<uint8_t>* DartContextData::GetPluginByteCode(const std::string& plugin_name,
+                                                               const std::string& source) const {
+  auto it = plugin_byte_code_.find(plugin_name);
+  if (it == plugin_byte_code_.end() || it->second.source != source)
+    return nullptr;
+  return &it->second.bytes;
+}
+
+void DartContextData::SetPluginByteCode(const std::string& plugin_name,
+                                        const std::string& source,
+                                        std::vector<uint8_t> bytes) {
+  plugin_byte_code_[plugin_name] = PluginByteCode{source, std::move(bytes)};
+}
+
+}  // namespace webf
@@ -6,7 +6,10 @@
 #define WEBF_CORE_DART_CONTEXT_DATA_H_
 
 #include <set>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "bindings/qjs/atomic_string.h"
 
 namespace webf {
@@ -23,12 +26,34 @@ class DartContextData {
   bool HasWidgetElementShape(const AtomicString& key);
   void SetWidgetElementShape(const AtomicString& key, const std::shared_ptr<WidgetElementShape>& shape);
 
+  // The attributes which dart side computes for the elements of a tag, nullptr until dart side sent them.
+  const std::unordered_set<AtomicString, AtomicString::KeyHasher>* GetDartComputedAttributes(
+      const AtomicString& tag_name) const;
+  void SetDartComputedAttributes(const AtomicString& tag_name,
+                                 std::unordered_set<AtomicString, AtomicString::KeyHasher> attributes);
+
+  // The bytecode of a plugin source registered by registerPluginCode(), nullptr until the first page compiled it.
+  const std::vector<uint8_t>* GetPluginByteCode(const std::string& plugin_name, const std::string& source) const;
+  void SetPluginByteCode(const std::string& plugin_name, const std::string& source, std::vector<uint8_t> bytes);
+
  private:
   // WidgetElements' properties and methods are defined in the dart Side.
   // When a new kind of WidgetElement first created, Dart code will sync properties and methods to C++ code to generate
   // prop getter and setter and functions for JS code. This map store the properties and methods of WidgetElement which
   // already created.
   std::unordered_map<AtomicString, std::shared_ptr<WidgetElementShape>, AtomicString::KeyHasher> widget_element_shapes_;
+  // ElementAttributes::getAttribute() asks dart side only for these attributes when they are missing in native side,
+  // see Element::HandleSyncComputedAttributesFromDart().
+  std::unordered_map<AtomicString, std::unordered_set<AtomicString, AtomicString::KeyHasher>, AtomicString::KeyHasher>
+      dart_computed_attributes_;
+  struct PluginByteCode {
+    // A plugin registered again with another source is compiled again.
+    std::string source;
+    std::vector<uint8_t> bytes;
+  };
+  // Plugin sources are compiled by the first page only, the bytecode doesn't depend on the JSContext which compiled
+  // it and is read by every new page instead.
+  std::unordered_map<std::string, PluginByteCode> plugin_byte_code_;
 };
 
 }  // namespace webf
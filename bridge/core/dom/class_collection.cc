@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "class_collection.h"
+#include "core/dom/element.h"
+#include "core/dom/element_data.h"
+
+namespace webf {
+
+ClassCollection::ClassCollection(ContainerNode& root_node, const AtomicString& class_names)
+    : HTMLCollection(root_node, kClassCollectionType, kInvalidateOnClassAttrChange),
+      class_names_(ElementData::SplitClassNames(root_node.ctx(), class_names)) {}
+
+bool ClassCollection::ElementMatches(const Element& element) const {
+  if (class_names_.empty())
+    return false;
+  for (auto& class_name : class_names_) {
+    if (!element.HasClass(class_name))
+      return false;
+  }
+  return true;
+}
+
+}  // namespace webf
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_DOM_CLASS_COLLECTION_H_
+#define BRIDGE_CORE_DOM_CLASS_COLLECTION_H_
+
+#include <vector>
+#include "core/html/legacy/html_collection.h"
+
+namespace webf {
+
+// The live collection returned by getElementsByClassName(), the elements must have all of the given class names.
+class ClassCollection final : public HTMLCollection {
+ public:
+  ClassCollection(ContainerNode& root_node, const AtomicString& class_names);
+
+ private:
+  bool ElementMatches(const Element&) const override;
+
+  std::vector<AtomicString> class_names_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_DOM_CLASS_COLLECTION_H_
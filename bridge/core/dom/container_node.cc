@@ -7,10 +7,12 @@
 #include "bindings/qjs/cppgc/garbage_collected.h"
 #include "bindings/qjs/cppgc/gc_visitor.h"
 #include "child_node_list.h"
+#include "class_collection.h"
 #include "core/html/html_all_collection.h"
 #include "document.h"
 #include "document_fragment.h"
 #include "node_traversal.h"
+#include "tag_collection.h"
 
 namespace webf {
 
@@ -27,6 +29,16 @@ std::vector<Element*> ContainerNode::Children() {
   return elements;
 }
 
+HTMLCollection* ContainerNode::getElementsByTagName(const AtomicString& qualified_name,
+                                                    ExceptionState& exception_state) {
+  return MakeGarbageCollected<TagCollection>(*this, qualified_name);
+}
+
+HTMLCollection* ContainerNode::getElementsByClassName(const AtomicString& class_names,
+                                                      ExceptionState& exception_state) {
+  return MakeGarbageCollected<ClassCollection>(*this, class_names);
+}
+
 unsigned ContainerNode::CountChildren() const {
   unsigned count = 0;
   for (Node* node = firstChild(); node; node = node->nextSibling())
@@ -415,13 +427,18 @@ void ContainerNode::InsertBeforeCommon(Node& next_child, Node& new_child) {
   new_child.SetPreviousSibling(prev);
   new_child.SetNextSibling(&next_child);
 
-  std::unique_ptr<NativeString> args_01 = stringToNativeString(std::to_string(new_child.eventTargetId()));
-  std::unique_ptr<NativeString> args_02 = stringToNativeString("beforebegin");
   GetExecutingContext()->uiCommandBuffer()->addCommand(next_child.eventTargetId(), UICommand::kInsertAdjacentNode,
-                                                       std::move(args_01), std::move(args_02), nullptr);
+                                                       std::to_string(new_child.eventTargetId()), "beforebegin",
+                                                       nullptr);
 }
 
-void ContainerNode::AppendChildCommon(Node& child) {
+void ContainerNode::AppendChildWithoutUICommand(Node& new_child) {
+  assert(!new_child.parentNode());
+  LinkLastChild(new_child);
+  NotifyNodeInsertedInternal(new_child);
+}
+
+void ContainerNode::LinkLastChild(Node& child) {
   child.SetParentOrShadowHostNode(this);
   if (last_child_) {
     child.SetPreviousSibling(last_child_);
@@ -430,15 +447,17 @@ void ContainerNode::AppendChildCommon(Node& child) {
     SetFirstChild(&child);
   }
   SetLastChild(&child);
+}
 
-  std::unique_ptr<NativeString> args_01 = stringToNativeString(std::to_string(child.eventTargetId()));
-  std::unique_ptr<NativeString> args_02 = stringToNativeString("beforeend");
+void ContainerNode::AppendChildCommon(Node& child) {
+  LinkLastChild(child);
 
   GetExecutingContext()->uiCommandBuffer()->addCommand(eventTargetId(), UICommand::kInsertAdjacentNode,
-                                                       std::move(args_01), std::move(args_02), nullptr);
+                                                       std::to_string(child.eventTargetId()), "beforeend", nullptr);
 }
 
 void ContainerNode::NotifyNodeInsertedInternal(Node& root) {
+  GetDocument().IncrementDomTreeVersion();
   for (Node& node : NodeTraversal::InclusiveDescendantsOf(root)) {
     // As an optimization we don't notify leaf nodes when when inserting
     // into detached subtrees that are not in a shadow tree.
@@ -449,6 +468,7 @@ void ContainerNode::NotifyNodeInsertedInternal(Node& root) {
 }
 
 void ContainerNode::NotifyNodeRemoved(Node& root) {
+  GetDocument().IncrementDomTreeVersion();
   for (Node& node : NodeTraversal::InclusiveDescendantsOf(root)) {
     // As an optimization we skip notifying Text nodes and other leaf nodes
     // of removal when they're not in the Document tree and not in a shadow root
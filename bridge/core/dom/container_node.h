@@ -14,6 +14,7 @@
 namespace webf {
 
 class HTMLAllCollection;
+class HTMLCollection;
 
 // This constant controls how much buffer is initially allocated
 // for a Node Vector that is used to store child Nodes of a given Node.
@@ -33,6 +34,9 @@ class ContainerNode : public Node {
 
   std::vector<Element*> Children();
 
+  HTMLCollection* getElementsByTagName(const AtomicString& qualified_name, ExceptionState& exception_state);
+  HTMLCollection* getElementsByClassName(const AtomicString& class_names, ExceptionState& exception_state);
+
   unsigned CountChildren() const;
 
   Node* InsertBefore(Node* new_child, Node* ref_child, ExceptionState&);
@@ -40,6 +44,9 @@ class ContainerNode : public Node {
   Node* RemoveChild(Node* child, ExceptionState&);
   Node* AppendChild(Node* new_child, ExceptionState&);
   Node* AppendChild(Node* new_child);
+  // Append a new node which has no parent, without sending the insertion to dart side. The caller must describe the
+  // insertion with another UI command, e.g. kCloneSubtree.
+  void AppendChildWithoutUICommand(Node& new_child);
   bool EnsurePreInsertionValidity(const Node& new_child,
                                   const Node* next,
                                   const Node* old_child,
@@ -79,6 +86,7 @@ class ContainerNode : public Node {
 
   void InsertBeforeCommon(Node& next_child, Node& new_child);
   void AppendChildCommon(Node& child);
+  void LinkLastChild(Node& child);
 
   void NotifyNodeInsertedInternal(Node&);
   void NotifyNodeRemoved(Node&);
@@ -3,7 +3,7 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 #include "document.h"
-#include "binding_call_methods.h"
+#include "binding_call_method_ids.h"
 #include "bindings/qjs/exception_message.h"
 #include "core/dom/comment.h"
 #include "core/dom/document_fragment.h"
@@ -120,55 +120,54 @@ bool Document::ChildTypeAllowed(NodeType type) const {
 }
 
 Element* Document::querySelector(const AtomicString& selectors, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kquerySelector, 1, arguments, exception_state);
+  SelectorQuery* query = selector_query_cache_.Add(ctx(), selectors, exception_state);
   if (exception_state.HasException()) {
     return nullptr;
   }
-  return NativeValueConverter<NativeTypePointer<Element>>::FromNativeValue(ctx(), result);
-}
+  if (query != nullptr) {
+    return query->QueryFirst(*this);
+  }
 
-std::vector<Element*> Document::querySelectorAll(const AtomicString& selectors, ExceptionState& exception_state) {
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kquerySelectorAll, 1, arguments, exception_state);
+  NativeValue result = InvokeBindingMethod(BindingMethodId::kquerySelector, 1, arguments, exception_state);
   if (exception_state.HasException()) {
-    return {};
+    return nullptr;
   }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+  return NativeValueConverter<NativeTypePointer<Element>>::FromNativeValue(ctx(), result);
 }
 
-Element* Document::getElementById(const AtomicString& id, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), id)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementById, 1, arguments, exception_state);
+std::vector<Element*> Document::querySelectorAll(const AtomicString& selectors, ExceptionState& exception_state) {
+  SelectorQuery* query = selector_query_cache_.Add(ctx(), selectors, exception_state);
   if (exception_state.HasException()) {
     return {};
   }
-  return NativeValueConverter<NativeTypePointer<Element>>::FromNativeValue(ctx(), result);
-}
+  if (query != nullptr) {
+    return query->QueryAll(*this);
+  }
 
-std::vector<Element*> Document::getElementsByClassName(const AtomicString& class_name,
-                                                       ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), class_name)};
-  NativeValue result =
-      InvokeBindingMethod(binding_call_methods::kgetElementsByClassName, 1, arguments, exception_state);
+  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
+  NativeValue result = InvokeBindingMethod(BindingMethodId::kquerySelectorAll, 1, arguments, exception_state);
   if (exception_state.HasException()) {
     return {};
   }
   return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
 }
 
-std::vector<Element*> Document::getElementsByTagName(const AtomicString& tag_name, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), tag_name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByTagName, 1, arguments, exception_state);
-  if (exception_state.HasException()) {
-    return {};
+void Document::InvalidateNodeListCaches(const AtomicString& attr_name) {
+  for (int type = 0; type < kNumNodeListInvalidationTypes; type++) {
+    auto invalidation_type = static_cast<NodeListInvalidationType>(type);
+    if (LiveNodeListBase::ShouldInvalidateTypeOnAttributeChange(invalidation_type, attr_name))
+      node_list_attribute_versions_[type]++;
   }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+}
+
+Element* Document::getElementById(const AtomicString& id, ExceptionState& exception_state) {
+  return TreeScope::getElementById(id);
 }
 
 std::vector<Element*> Document::getElementsByName(const AtomicString& name, ExceptionState& exception_state) {
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByName, 1, arguments, exception_state);
+  NativeValue result = InvokeBindingMethod(BindingMethodId::kgetElementsByName, 1, arguments, exception_state);
   if (exception_state.HasException()) {
     return {};
   }
@@ -317,6 +316,7 @@ bool Document::IsAttributeDefinedInternal(const AtomicString& key) const {
 
 void Document::Trace(GCVisitor* visitor) const {
   script_animation_controller_.Trace(visitor);
+  html_fragment_cache_.Trace(visitor);
   ContainerNode::Trace(visitor);
 }
 
@@ -8,6 +8,7 @@ import {HTMLHtmlElement} from "../html/html_html_element";
 import {Element} from "./element";
 import {Event} from "./events/event";
 import {HTMLAllCollection} from "../html/html_all_collection";
+import {HTMLCollection} from "../html/legacy/html_collection";
 
 interface Document extends Node {
   readonly all: HTMLAllCollection;
@@ -25,8 +26,8 @@ interface Document extends Node {
   createEvent(event_type: string): Event;
 
   getElementById(id: string): Element | null;
-  getElementsByClassName(className: string) : Element[];
-  getElementsByTagName(tagName: string): Element[];
+  getElementsByClassName(className: string) : HTMLCollection;
+  getElementsByTagName(tagName: string): HTMLCollection;
   getElementsByName(name: string): Element[];
 
   querySelector(selectors: string): Element | null;
@@ -7,7 +7,9 @@
 
 #include "bindings/qjs/cppgc/local_handle.h"
 #include "container_node.h"
+#include "core/html/parser/html_fragment_cache.h"
 #include "scripted_animation_controller.h"
+#include "selector_query.h"
 #include "tree_scope.h"
 
 namespace webf {
@@ -61,8 +63,6 @@ class Document : public ContainerNode, public TreeScope {
   std::vector<Element*> querySelectorAll(const AtomicString& selectors, ExceptionState& exception_state);
 
   Element* getElementById(const AtomicString& id, ExceptionState& exception_state);
-  std::vector<Element*> getElementsByClassName(const AtomicString& class_name, ExceptionState& exception_state);
-  std::vector<Element*> getElementsByTagName(const AtomicString& tag_name, ExceptionState& exception_state);
   std::vector<Element*> getElementsByName(const AtomicString& name, ExceptionState& exception_state);
 
   // The following implements the rule from HTML 4 for what valid names are.
@@ -89,6 +89,21 @@ class Document : public ContainerNode, public TreeScope {
   }
   int NodeCount() const { return node_count_; }
 
+  SelectorQueryCache& GetSelectorQueryCache() { return selector_query_cache_; }
+  HTMLFragmentCache& GetHTMLFragmentCache() { return html_fragment_cache_; }
+
+  // Live node lists compare these with the versions their caches were built against.
+  uint64_t DomTreeVersion() const { return dom_tree_version_; }
+  void IncrementDomTreeVersion() { dom_tree_version_++; }
+  uint64_t NodeListAttributeVersion(NodeListInvalidationType type) const { return node_list_attribute_versions_[type]; }
+  void InvalidateNodeListCaches(const AtomicString& attr_name);
+
+  // Element geometry caches compare this with the version their geometry was read at. It changes whenever the layout
+  // at dart side may have changed: a UI command which affects layout is queued, a binding call changes layout, an event
+  // comes from dart side, or a frame ends.
+  uint64_t LayoutVersion() const { return layout_version_; }
+  void InvalidateLayout() { layout_version_++; }
+
   uint32_t RequestAnimationFrame(const std::shared_ptr<FrameCallback>& callback, ExceptionState& exception_state);
   void CancelAnimationFrame(uint32_t request_id, ExceptionState& exception_state);
 
@@ -106,6 +121,12 @@ class Document : public ContainerNode, public TreeScope {
  private:
   int node_count_{0};
   ScriptAnimationController script_animation_controller_;
+  SelectorQueryCache selector_query_cache_;
+  HTMLFragmentCache html_fragment_cache_;
+  uint64_t dom_tree_version_{0};
+  // Starts at 1, 0 marks an element geometry which was never read.
+  uint64_t layout_version_{1};
+  uint64_t node_list_attribute_versions_[kNumNodeListInvalidationTypes]{};
 };
 
 template <>
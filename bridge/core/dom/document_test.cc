@@ -124,6 +124,44 @@ TEST(Document, instanceofNode) {
   EXPECT_EQ(logCalled, true);
 }
 
+TEST(Document, getElementById) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "true true true true true true true true");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let a = document.createElement('div');"
+      "let b = document.createElement('span');"
+      "a.id = 'foo';"
+      "b.setAttribute('id', 'foo');"
+      "let detached = document.getElementById('foo') === null;"
+      "document.body.appendChild(a);"
+      "let first = document.getElementById('foo') === a;"
+      "document.body.insertBefore(b, a);"
+      "let duplicated = document.getElementById('foo') === b;"
+      "document.body.removeChild(b);"
+      "let removed = document.getElementById('foo') === a;"
+      "a.id = 'bar';"
+      "let renamed = document.getElementById('foo') === null && document.getElementById('bar') === a;"
+      "a.removeAttribute('id');"
+      "let cleared = document.getElementById('bar') === null;"
+      "let container = document.createElement('div');"
+      "container.appendChild(b);"
+      "document.body.appendChild(container);"
+      "let nested = document.getElementById('foo') === b;"
+      "let empty = document.getElementById('') === null;"
+      "console.log(detached, first, duplicated, removed, renamed, cleared, nested, empty);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
 TEST(Document, FreedByOutOfScope) {
   bool static errorCalled = false;
   bool static logCalled = false;
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "dom_token_list.h"
+#include <algorithm>
+#include "bindings/qjs/exception_state.h"
+#include "core/dom/element.h"
+
+namespace webf {
+
+template <typename CharType>
+static bool ContainsHTMLSpace(const CharType* characters, unsigned length) {
+  for (unsigned i = 0; i < length; i++) {
+    CharType c = characters[i];
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f')
+      return true;
+  }
+  return false;
+}
+
+DOMTokenList::DOMTokenList(Element* element) : ScriptWrappable(element->ctx()), element_(element) {}
+
+uint32_t DOMTokenList::length() const {
+  return Tokens().size();
+}
+
+AtomicString DOMTokenList::item(uint32_t index, ExceptionState& exception_state) const {
+  const std::vector<AtomicString>& tokens = Tokens();
+  if (index >= tokens.size())
+    return AtomicString::Empty();
+  return tokens[index];
+}
+
+bool DOMTokenList::contains(const AtomicString& token, ExceptionState& exception_state) const {
+  return element_->HasClass(token);
+}
+
+void DOMTokenList::add(const std::vector<AtomicString>& tokens, ExceptionState& exception_state) {
+  for (const AtomicString& token : tokens) {
+    if (!ValidateToken(token, exception_state))
+      return;
+  }
+
+  std::vector<AtomicString> class_names = Tokens();
+  for (const AtomicString& token : tokens) {
+    if (std::find(class_names.begin(), class_names.end(), token) == class_names.end())
+      class_names.emplace_back(token);
+  }
+  if (class_names.size() != Tokens().size())
+    element_->SetClassNames(std::move(class_names), exception_state);
+}
+
+void DOMTokenList::remove(const std::vector<AtomicString>& tokens, ExceptionState& exception_state) {
+  for (const AtomicString& token : tokens) {
+    if (!ValidateToken(token, exception_state))
+      return;
+  }
+
+  std::vector<AtomicString> class_names = Tokens();
+  for (const AtomicString& token : tokens) {
+    class_names.erase(std::remove(class_names.begin(), class_names.end(), token), class_names.end());
+  }
+  if (class_names.size() != Tokens().size())
+    element_->SetClassNames(std::move(class_names), exception_state);
+}
+
+bool DOMTokenList::toggle(const AtomicString& token, ExceptionState& exception_state) {
+  return toggle(token, !element_->HasClass(token), exception_state);
+}
+
+bool DOMTokenList::toggle(const AtomicString& token, bool force, ExceptionState& exception_state) {
+  if (!ValidateToken(token, exception_state))
+    return false;
+
+  if (force) {
+    add({token}, exception_state);
+  } else {
+    remove({token}, exception_state);
+  }
+  return force;
+}
+
+bool DOMTokenList::replace(const AtomicString& token, const AtomicString& new_token, ExceptionState& exception_state) {
+  if (!ValidateToken(token, exception_state) || !ValidateToken(new_token, exception_state))
+    return false;
+
+  std::vector<AtomicString> class_names = Tokens();
+  auto it = std::find(class_names.begin(), class_names.end(), token);
+  if (it == class_names.end())
+    return false;
+  if (token == new_token)
+    return true;
+
+  // The new token takes the place of the old one, unless it's already in the list.
+  if (element_->HasClass(new_token)) {
+    class_names.erase(it);
+  } else {
+    *it = new_token;
+  }
+  element_->SetClassNames(std::move(class_names), exception_state);
+  return true;
+}
+
+AtomicString DOMTokenList::value() const {
+  return element_->className();
+}
+
+void DOMTokenList::setValue(const AtomicString& value, ExceptionState& exception_state) {
+  element_->setClassName(value, exception_state);
+}
+
+bool DOMTokenList::NamedPropertyQuery(const AtomicString& key, ExceptionState& exception_state) {
+  std::string string = key.ToStdString(ctx());
+  if (string.empty() || string.length() > 9 ||
+      !std::all_of(string.begin(), string.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    return false;
+  return std::stoul(string) < length();
+}
+
+void DOMTokenList::NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState& exception_state) {
+  uint32_t size = length();
+  for (uint32_t i = 0; i < size; i++) {
+    names.emplace_back(AtomicString(ctx(), std::to_string(i)));
+  }
+}
+
+void DOMTokenList::Trace(GCVisitor* visitor) const {
+  visitor->Trace(element_);
+}
+
+bool DOMTokenList::ValidateToken(const AtomicString& token, ExceptionState& exception_state) const {
+  StringView view = token.ToStringView();
+  if (view.Empty()) {
+    exception_state.ThrowException(ctx(), ErrorType::SyntaxError, "The token provided must not be empty.");
+    return false;
+  }
+  bool has_space = view.Is8Bit() ? ContainsHTMLSpace(view.Characters8(), view.length())
+                                 : ContainsHTMLSpace(view.Characters16(), view.length());
+  if (has_space) {
+    exception_state.ThrowException(ctx(), ErrorType::SyntaxError,
+                                   "The token provided ('" + token.ToStdString(ctx()) +
+                                       "') contains HTML space characters, which are not valid in tokens.");
+    return false;
+  }
+  return true;
+}
+
+const std::vector<AtomicString>& DOMTokenList::Tokens() const {
+  return element_->ClassNames();
+}
+
+}  // namespace webf
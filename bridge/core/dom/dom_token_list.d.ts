@@ -0,0 +1,12 @@
+export interface DOMTokenList {
+  readonly length: number;
+  value: string;
+  item(index: number): string | null;
+  contains(token: string): boolean;
+  add(...tokens: string[]): void;
+  remove(...tokens: string[]): void;
+  toggle(token: string, force?: boolean): boolean;
+  replace(token: string, newToken: string): boolean;
+  readonly [index: number]: string;
+  new(): void;
+}
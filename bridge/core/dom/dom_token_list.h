@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_DOM_DOM_TOKEN_LIST_H_
+#define BRIDGE_CORE_DOM_DOM_TOKEN_LIST_H_
+
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/cppgc/member.h"
+#include "bindings/qjs/script_wrappable.h"
+
+namespace webf {
+
+class Element;
+class ExceptionState;
+
+// Element.classList. The tokens are the class names kept by ElementData, so reads never parse the class attribute,
+// and a change writes the class attribute only when the set of tokens really changed. Repeated writes of the
+// attribute before the next flush are collapsed by the UI command buffer.
+// https://dom.spec.whatwg.org/#interface-domtokenlist
+class DOMTokenList : public ScriptWrappable {
+  DEFINE_WRAPPERTYPEINFO();
+
+ public:
+  using ImplType = DOMTokenList*;
+
+  static DOMTokenList* Create(Element* element) { return MakeGarbageCollected<DOMTokenList>(element); }
+
+  explicit DOMTokenList(Element* element);
+
+  uint32_t length() const;
+  AtomicString item(uint32_t index, ExceptionState& exception_state) const;
+  bool contains(const AtomicString& token, ExceptionState& exception_state) const;
+  void add(const std::vector<AtomicString>& tokens, ExceptionState& exception_state);
+  void remove(const std::vector<AtomicString>& tokens, ExceptionState& exception_state);
+  bool toggle(const AtomicString& token, ExceptionState& exception_state);
+  bool toggle(const AtomicString& token, bool force, ExceptionState& exception_state);
+  bool replace(const AtomicString& token, const AtomicString& new_token, ExceptionState& exception_state);
+  AtomicString value() const;
+  void setValue(const AtomicString& value, ExceptionState& exception_state);
+
+  bool NamedPropertyQuery(const AtomicString& key, ExceptionState& exception_state);
+  void NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState& exception_state);
+
+  void Trace(GCVisitor* visitor) const override;
+
+ private:
+  // https://dom.spec.whatwg.org/#concept-domtokenlist-validation, throws a SyntaxError for the empty string and for
+  // the tokens with whitespace.
+  bool ValidateToken(const AtomicString& token, ExceptionState& exception_state) const;
+  const std::vector<AtomicString>& Tokens() const;
+
+  Member<Element> element_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_DOM_DOM_TOKEN_LIST_H_
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(DOMTokenList, classList) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "a c d 3 true false true false true c e SyntaxError");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let div = document.createElement('div');"
+      "div.className = ' a  b ';"
+      "div.classList.add('c', 'a', 'd');"
+      "div.classList.remove('b');"
+      "let className = div.className;"
+      "let length = div.classList.length;"
+      "let contains = div.classList.contains('c');"
+      "let toggled = div.classList.toggle('a');"
+      "let forced = div.classList.toggle('c', true);"
+      "let replaced = div.classList.replace('x', 'y');"
+      "div.classList.replace('d', 'e');"
+      "let error;"
+      "try { div.classList.add('f g'); } catch (e) { error = e.name; }"
+      "console.log(className, length, contains, toggled, forced, replaced, div.classList.value === 'c e',"
+      "  div.classList[0], div.classList.item(1), error);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(DOMTokenList, onlyChangedTokensAreSent) {
+  bool static errorCalled = false;
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  const char* code = "let div = document.createElement('div'); div.className = 'a';";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  context->FlushUICommand();
+  buffer->SetCoalescingEnabled(false);
+
+  // Only the first add() and the remove() change the tokens.
+  const char* toggle =
+      "div.classList.add('active');"
+      "div.classList.add('active', 'a');"
+      "div.classList.toggle('a', true);"
+      "div.classList.remove('missing');"
+      "div.classList.remove('active');";
+  bridge->evaluateScript(toggle, strlen(toggle), "vm://", 0);
+
+  UICommandItem* items = buffer->data();
+  int set_attribute_count = 0;
+  for (int64_t i = 0; i < buffer->size(); i++) {
+    if (items[i].type == static_cast<int32_t>(UICommand::kSetAttribute))
+      set_attribute_count++;
+  }
+  EXPECT_EQ(set_attribute_count, 2);
+  buffer->clear();
+  EXPECT_EQ(errorCalled, false);
+}
@@ -3,15 +3,22 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 #include "element.h"
+#include <algorithm>
 #include <utility>
-#include "binding_call_methods.h"
+#include "binding_call_method_ids.h"
 #include "bindings/qjs/exception_state.h"
 #include "bindings/qjs/script_promise.h"
 #include "bindings/qjs/script_promise_resolver.h"
+#include "built_in_string.h"
+#include "core/dart_context.h"
+#include "core/dom/document.h"
 #include "core/dom/document_fragment.h"
+#include "core/dom/element_traversal.h"
+#include "core/dom/selector_query.h"
 #include "core/fileapi/blob.h"
 #include "core/html/html_template_element.h"
 #include "core/html/parser/html_parser.h"
+#include "core/html/serializers/html_serializer.h"
 #include "element_attribute_names.h"
 #include "foundation/native_value_converter.h"
 #include "html_element_type_helper.h"
@@ -22,8 +29,8 @@ namespace webf {
 
 Element::Element(const AtomicString& tag_name, Document* document, Node::ConstructionType construction_type)
     : ContainerNode(document, construction_type), tag_name_(tag_name) {
-  GetExecutingContext()->uiCommandBuffer()->addCommand(
-      eventTargetId(), UICommand::kCreateElement, std::move(tag_name.ToNativeString(ctx())), (void*)bindingObject());
+  GetExecutingContext()->uiCommandBuffer()->addCommand(eventTargetId(), UICommand::kCreateElement, tag_name,
+                                                       (void*)bindingObject());
 }
 
 ElementAttributes& Element::EnsureElementAttributes() {
@@ -65,16 +72,208 @@ void Element::removeAttribute(const AtomicString& name, ExceptionState& exceptio
   EnsureElementAttributes().removeAttribute(name, exception_state);
 }
 
+void Element::AttributeChanged(const AtomicString& name, const AtomicString& value) {
+  GetDocument().InvalidateNodeListCaches(name);
+  if (name == element_attribute_names::kid) {
+    if (isConnected()) {
+      const AtomicString& old_id = GetIdAttribute();
+      if (!old_id.IsEmpty())
+        GetTreeScope().RemoveElementById(old_id, *this);
+      if (!value.IsEmpty())
+        GetTreeScope().AddElementById(value, *this);
+    }
+    EnsureElementData().SetIdAttribute(value);
+  } else if (name == element_attribute_names::kclass) {
+    // Already up to date when the value comes from SetClassNames().
+    if (value != className())
+      UpdateClass(value, ElementData::SplitClassNames(ctx(), value));
+  } else if (name == element_attribute_names::kstyle) {
+    if (CSSStyleDeclaration* inline_style = style()) {
+      std::string text = value.ToStdString(ctx());
+      inline_style->SetCSSText(text.c_str(), text.length());
+    }
+  }
+}
+
+void Element::InsertedInto(ContainerNode& insertion_point) {
+  ContainerNode::InsertedInto(insertion_point);
+  if (!insertion_point.isConnected())
+    return;
+  const AtomicString& id = GetIdAttribute();
+  if (!id.IsEmpty())
+    GetTreeScope().AddElementById(id, *this);
+  for (const AtomicString& class_name : ClassNames())
+    GetTreeScope().AddElementByClass(class_name, *this);
+}
+
+void Element::RemovedFrom(ContainerNode& insertion_point) {
+  if (insertion_point.isConnected()) {
+    const AtomicString& id = GetIdAttribute();
+    if (!id.IsEmpty())
+      GetTreeScope().RemoveElementById(id, *this);
+    for (const AtomicString& class_name : ClassNames())
+      GetTreeScope().RemoveElementByClass(class_name, *this);
+  }
+  ContainerNode::RemovedFrom(insertion_point);
+}
+
+const AtomicString* Element::FastGetAttribute(const AtomicString& name) const {
+  if (attributes_ == nullptr)
+    return nullptr;
+  return attributes_->FindAttribute(name);
+}
+
+AtomicString Element::id() const {
+  return GetIdAttribute();
+}
+
+void Element::setId(const AtomicString& value, ExceptionState& exception_state) {
+  setAttribute(element_attribute_names::kid, value, exception_state);
+}
+
+AtomicString Element::className() const {
+  if (element_data_ == nullptr)
+    return AtomicString::Empty();
+  return element_data_->ClassAttribute();
+}
+
+void Element::setClassName(const AtomicString& value, ExceptionState& exception_state) {
+  setAttribute(element_attribute_names::kclass, value, exception_state);
+}
+
+const AtomicString& Element::GetIdAttribute() const {
+  if (element_data_ == nullptr)
+    return built_in_string::kempty_string;
+  return element_data_->IdForStyleResolution();
+}
+
+bool Element::HasClass(const AtomicString& class_name) const {
+  return element_data_ != nullptr && element_data_->HasClass(class_name);
+}
+
+const std::vector<AtomicString>& Element::ClassNames() const {
+  static const std::vector<AtomicString> empty_class_names;
+  if (element_data_ == nullptr)
+    return empty_class_names;
+  return element_data_->ClassNames();
+}
+
+DOMTokenList* Element::classList() {
+  if (class_list_ == nullptr) {
+    class_list_ = DOMTokenList::Create(this);
+  }
+  return class_list_;
+}
+
+void Element::SetClassNames(std::vector<AtomicString> class_names, ExceptionState& exception_state) {
+  std::string value;
+  for (const AtomicString& class_name : class_names) {
+    if (!value.empty())
+      value += ' ';
+    value += class_name.ToStdString(ctx());
+  }
+  AtomicString class_value = AtomicString(ctx(), value);
+  UpdateClass(class_value, std::move(class_names));
+  EnsureElementAttributes().setAttribute(element_attribute_names::kclass, class_value, exception_state);
+}
+
+void Element::UpdateClass(const AtomicString& class_value, std::vector<AtomicString> class_names) {
+  if (isConnected()) {
+    TreeScope& tree_scope = GetTreeScope();
+    for (const AtomicString& class_name : ClassNames()) {
+      if (std::find(class_names.begin(), class_names.end(), class_name) == class_names.end())
+        tree_scope.RemoveElementByClass(class_name, *this);
+    }
+    for (const AtomicString& class_name : class_names) {
+      if (!HasClass(class_name))
+        tree_scope.AddElementByClass(class_name, *this);
+    }
+  }
+  EnsureElementData().SetClass(class_value, std::move(class_names));
+}
+
+Element* Element::querySelector(const AtomicString& selectors, ExceptionState& exception_state) {
+  SelectorQuery* query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors, exception_state);
+  if (exception_state.HasException()) {
+    return nullptr;
+  }
+  if (query != nullptr) {
+    return query->QueryFirst(*this);
+  }
+
+  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
+  NativeValue result = InvokeBindingMethod(BindingMethodId::kquerySelector, 1, arguments, exception_state);
+  if (exception_state.HasException()) {
+    return nullptr;
+  }
+  return NativeValueConverter<NativeTypePointer<Element>>::FromNativeValue(ctx(), result);
+}
+
+std::vector<Element*> Element::querySelectorAll(const AtomicString& selectors, ExceptionState& exception_state) {
+  SelectorQuery* query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors, exception_state);
+  if (exception_state.HasException()) {
+    return {};
+  }
+  if (query != nullptr) {
+    return query->QueryAll(*this);
+  }
+
+  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
+  NativeValue result = InvokeBindingMethod(BindingMethodId::kquerySelectorAll, 1, arguments, exception_state);
+  if (exception_state.HasException()) {
+    return {};
+  }
+  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+}
+
+bool Element::matches(const AtomicString& selectors, ExceptionState& exception_state) {
+  SelectorQuery* query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors, exception_state);
+  if (exception_state.HasException()) {
+    return false;
+  }
+  if (query != nullptr) {
+    return query->Matches(*this);
+  }
+
+  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
+  NativeValue result = InvokeBindingMethod(BindingMethodId::kmatches, 1, arguments, exception_state);
+  if (exception_state.HasException()) {
+    return false;
+  }
+  return NativeValueConverter<NativeTypeBool>::FromNativeValue(result);
+}
+
+Element* Element::closest(const AtomicString& selectors, ExceptionState& exception_state) {
+  SelectorQuery* query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors, exception_state);
+  if (exception_state.HasException()) {
+    return nullptr;
+  }
+  if (query != nullptr) {
+    return query->Closest(*this);
+  }
+
+  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
+  NativeValue result = InvokeBindingMethod(BindingMethodId::kclosest, 1, arguments, exception_state);
+  if (exception_state.HasException()) {
+    return nullptr;
+  }
+  return NativeValueConverter<NativeTypePointer<Element>>::FromNativeValue(ctx(), result);
+}
+
 BoundingClientRect* Element::getBoundingClientRect(ExceptionState& exception_state) {
-  GetExecutingContext()->FlushUICommand();
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetBoundingClientRect, 0, nullptr, exception_state);
-  return BoundingClientRect::Create(
-      GetExecutingContext(), NativeValueConverter<NativeTypePointer<NativeBindingObject>>::FromNativeValue(result));
+  if (!HasValidGeometry()) {
+    UpdateGeometry(exception_state);
+    if (exception_state.HasException())
+      return nullptr;
+  }
+  return BoundingClientRect::Create(GetExecutingContext(), geometry_->Get(ElementGeometryField::kRectX),
+                                    geometry_->Get(ElementGeometryField::kRectY),
+                                    geometry_->Get(ElementGeometryField::kRectWidth),
+                                    geometry_->Get(ElementGeometryField::kRectHeight));
 }
 
 void Element::click(ExceptionState& exception_state) {
-  GetExecutingContext()->FlushUICommand();
-  InvokeBindingMethod(binding_call_methods::kclick, 0, nullptr, exception_state);
+  InvokeBindingMethod(BindingMethodId::kclick, 0, nullptr, exception_state);
 }
 
 void Element::scroll(ExceptionState& exception_state) {
@@ -82,21 +281,19 @@ void Element::scroll(ExceptionState& exception_state) {
 }
 
 void Element::scroll(double x, double y, ExceptionState& exception_state) {
-  GetExecutingContext()->FlushUICommand();
   const NativeValue args[] = {
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(x),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(y),
   };
-  InvokeBindingMethod(binding_call_methods::kscroll, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscroll, 2, args, exception_state);
 }
 
 void Element::scroll(const std::shared_ptr<ScrollToOptions>& options, ExceptionState& exception_state) {
-  GetExecutingContext()->FlushUICommand();
   const NativeValue args[] = {
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasLeft() ? options->left() : 0.0),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasTop() ? options->top() : 0.0),
   };
-  InvokeBindingMethod(binding_call_methods::kscroll, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscroll, 2, args, exception_state);
 }
 
 void Element::scrollBy(ExceptionState& exception_state) {
@@ -104,21 +301,117 @@ void Element::scrollBy(ExceptionState& exception_state) {
 }
 
 void Element::scrollBy(double x, double y, ExceptionState& exception_state) {
-  GetExecutingContext()->FlushUICommand();
   const NativeValue args[] = {
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(x),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(y),
   };
-  InvokeBindingMethod(binding_call_methods::kscrollBy, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscrollBy, 2, args, exception_state);
 }
 
 void Element::scrollBy(const std::shared_ptr<ScrollToOptions>& options, ExceptionState& exception_state) {
-  GetExecutingContext()->FlushUICommand();
   const NativeValue args[] = {
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasLeft() ? options->left() : 0.0),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasTop() ? options->top() : 0.0),
   };
-  InvokeBindingMethod(binding_call_methods::kscrollBy, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscrollBy, 2, args, exception_state);
+}
+
+double Element::clientTop() {
+  return GetGeometry(ElementGeometryField::kClientTop);
+}
+
+double Element::clientLeft() {
+  return GetGeometry(ElementGeometryField::kClientLeft);
+}
+
+double Element::clientWidth() {
+  return GetGeometry(ElementGeometryField::kClientWidth);
+}
+
+double Element::clientHeight() {
+  return GetGeometry(ElementGeometryField::kClientHeight);
+}
+
+double Element::scrollTop() {
+  return GetGeometry(ElementGeometryField::kScrollTop);
+}
+
+void Element::setScrollTop(double value, ExceptionState& exception_state) {
+  SetBindingProperty(BindingMethodId::kscrollTop, NativeValueConverter<NativeTypeDouble>::ToNativeValue(value),
+                     exception_state);
+}
+
+double Element::scrollLeft() {
+  return GetGeometry(ElementGeometryField::kScrollLeft);
+}
+
+void Element::setScrollLeft(double value, ExceptionState& exception_state) {
+  SetBindingProperty(BindingMethodId::kscrollLeft, NativeValueConverter<NativeTypeDouble>::ToNativeValue(value),
+                     exception_state);
+}
+
+double Element::scrollWidth() {
+  return GetGeometry(ElementGeometryField::kScrollWidth);
+}
+
+double Element::scrollHeight() {
+  return GetGeometry(ElementGeometryField::kScrollHeight);
+}
+
+double Element::GetGeometry(ElementGeometryField field) {
+  if (!HasValidGeometry()) {
+    ExceptionState exception_state;
+    UpdateGeometry(exception_state);
+    if (exception_state.HasException()) {
+      GetExecutingContext()->HandleException(exception_state);
+      return 0;
+    }
+  }
+  return geometry_->Get(field);
+}
+
+bool Element::HasValidGeometry() const {
+  return geometry_ != nullptr && geometry_->layout_version == GetDocument().LayoutVersion();
+}
+
+// Scripts usually measure the items of a list one after another, so a query also reads the following siblings.
+static const size_t kMaximumElementGeometryBatchSize = 64;
+
+void Element::UpdateGeometry(ExceptionState& exception_state) {
+  std::vector<Element*> elements{this};
+  for (Element* sibling = ElementTraversal::NextSibling(*this);
+       sibling != nullptr && elements.size() < kMaximumElementGeometryBatchSize;
+       sibling = ElementTraversal::NextSibling(*sibling)) {
+    if (!sibling->HasValidGeometry()) {
+      elements.emplace_back(sibling);
+    }
+  }
+
+  // Read before the query, layout invalidated by the query itself (e.g. events fired from dart side) must not be
+  // covered by the results.
+  Document& document = GetDocument();
+  uint64_t layout_version = document.LayoutVersion();
+  std::vector<double> values(elements.size() * kElementGeometryFieldCount);
+  std::vector<NativeValue> arguments;
+  arguments.reserve(elements.size() + 1);
+  arguments.emplace_back(Native_NewPtr(JSPointerType::Others, values.data()));
+  for (Element* element : elements) {
+    arguments.emplace_back(NativeValueConverter<NativeTypePointer<Element>>::ToNativeValue(element));
+  }
+  document.InvokeBindingMethod(BindingMethodId::kgetGeometryOfElements, static_cast<int32_t>(arguments.size()),
+                               arguments.data(), exception_state);
+  if (exception_state.HasException())
+    return;
+
+  for (size_t i = 0; i < elements.size(); i++) {
+    Element* element = elements[i];
+    if (element->geometry_ == nullptr) {
+      element->geometry_ = std::make_unique<ElementGeometry>();
+    }
+    element->geometry_->layout_version = layout_version;
+    std::copy_n(values.begin() + i * kElementGeometryFieldCount, kElementGeometryFieldCount,
+                element->geometry_->values);
+  }
 }
 
 void Element::scrollTo(ExceptionState& exception_state) {
@@ -149,25 +442,6 @@ std::string Element::nodeNameLowerCase() const {
   return tag_name_.ToStdString(ctx());
 }
 
-std::vector<Element*> Element::getElementsByClassName(const AtomicString& class_name, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), class_name)};
-  NativeValue result =
-      InvokeBindingMethod(binding_call_methods::kgetElementsByClassName, 1, arguments, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
-}
-
-std::vector<Element*> Element::getElementsByTagName(const AtomicString& tag_name, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), tag_name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByTagName, 1, arguments, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
-}
-
 CSSStyleDeclaration* Element::style() {
   if (!IsStyledElement())
     return nullptr;
@@ -225,9 +499,27 @@ bool Element::IsAttributeDefinedInternal(const AtomicString& key) const {
   return QJSElement::IsAttributeDefinedInternal(key) || Node::IsAttributeDefinedInternal(key);
 }
 
+NativeValue Element::HandleCallFromDartSide(const NativeValue* native_method, int32_t argc, const NativeValue* argv) {
+  auto method = static_cast<BindingMethodId>(NativeValueConverter<NativeTypeInt64>::FromNativeValue(*native_method));
+  if (method == BindingMethodId::ksyncComputedAttributes) {
+    return HandleSyncComputedAttributesFromDart(argc, argv);
+  }
+  return ContainerNode::HandleCallFromDartSide(native_method, argc, argv);
+}
+
+// Dart side sends the attributes it computes once for each tag, when it creates the first element of the tag.
+NativeValue Element::HandleSyncComputedAttributesFromDart(int32_t argc, const NativeValue* argv) {
+  assert(argc == 1);
+  auto&& attributes = NativeValueConverter<NativeTypeArray<NativeTypeString>>::FromNativeValue(ctx(), argv[0]);
+  GetExecutingContext()->dartContext()->EnsureData()->SetDartComputedAttributes(
+      tag_name_, std::unordered_set<AtomicString, AtomicString::KeyHasher>(attributes.begin(), attributes.end()));
+  return Native_NewBool(true);
+}
+
 void Element::Trace(GCVisitor* visitor) const {
   visitor->Trace(attributes_);
   visitor->Trace(cssom_wrapper_);
+  visitor->Trace(class_list_);
   ContainerNode::Trace(visitor);
 }
 
@@ -246,9 +538,8 @@ Node* Element::Clone(Document& factory, CloneChildrenFlag flag) const {
     copy = &CloneWithChildren(flag, &factory);
   }
 
-  std::unique_ptr<NativeString> args_01 = stringToNativeString(std::to_string(copy->eventTargetId()));
-  GetExecutingContext()->uiCommandBuffer()->addCommand(eventTargetId(), UICommand::kCloneNode, std::move(args_01),
-                                                       nullptr);
+  GetExecutingContext()->uiCommandBuffer()->addCommand(eventTargetId(), UICommand::kCloneNode,
+                                                       std::to_string(copy->eventTargetId()), nullptr);
 
   return copy;
 }
@@ -279,6 +570,12 @@ class ElementSnapshotReader {
 };
 
 void ElementSnapshotReader::Start() {
+  if (!context_->IsBoundToContextId()) {
+    HandleFailed("Failed to execute 'toBlob': the page is not bound to a context id yet.");
+    delete this;
+    return;
+  }
+
   context_->FlushUICommand();
 
   auto callback = [](void* ptr, int32_t contextId, const char* error, uint8_t* bytes, int32_t length) -> void {
@@ -319,58 +616,23 @@ ScriptPromise Element::toBlob(double device_pixel_ratio, ExceptionState& excepti
   return resolver->Promise();
 }
 
-std::string Element::outerHTML() {
-  std::string s = "<" + nodeNameLowerCase();
-
-  // Read attributes
-  if (attributes_ != nullptr) {
-    s += " " + attributes_->ToString();
-  }
-  if (cssom_wrapper_ != nullptr) {
-    s += " style=\"" + cssom_wrapper_->ToString();
-  }
-
-  s += ">";
-
-  std::string childHTML = innerHTML();
-  s += childHTML;
-  s += "</" + nodeNameLowerCase() + ">";
-
-  return s;
+ScriptValue Element::outerHTML() {
+  return HTMLSerializer::Serialize(*this, HTMLSerializer::ChildrenOnly::kIncludeNode);
 }
 
-std::string Element::innerHTML() {
-  std::string s;
-
-  // If Element is TemplateElement, the innerHTML content is the content of documentFragment.
-  Node* parent = To<Node>(this);
-
-  if (auto* template_element = DynamicTo<HTMLTemplateElement>(this)) {
-    parent = To<Node>(template_element->content());
-  }
-
-  if (parent->firstChild() == nullptr)
-    return s;
-
-  auto* child = parent->firstChild();
-  while (child != nullptr) {
-    if (auto* element = DynamicTo<Element>(child)) {
-      s += element->outerHTML();
-    } else if (auto* text = DynamicTo<Text>(child)) {
-      s += text->data().ToStdString(ctx());
-    }
-    child = child->nextSibling();
-  }
-
-  return s;
+ScriptValue Element::innerHTML() {
+  return HTMLSerializer::Serialize(*this, HTMLSerializer::ChildrenOnly::kChildrenOnly);
 }
 
 void Element::setInnerHTML(const AtomicString& value, ExceptionState& exception_state) {
   auto html = value.ToStdString(ctx());
+  ContainerNode* root = this;
   if (auto* template_element = DynamicTo<HTMLTemplateElement>(this)) {
-    HTMLParser::parseHTMLFragment(html.c_str(), html.size(), template_element->content());
-  } else {
-    HTMLParser::parseHTMLFragment(html.c_str(), html.size(), this);
+    root = template_element->content();
+  }
+
+  if (!GetDocument().GetHTMLFragmentCache().ReplaceChildren(*root, html)) {
+    HTMLParser::parseHTMLFragment(html.c_str(), html.size(), root);
   }
 }
 
@@ -9,7 +9,9 @@
 #include "bindings/qjs/script_promise.h"
 #include "container_node.h"
 #include "core/css/legacy/css_style_declaration.h"
+#include "dom_token_list.h"
 #include "element_data.h"
+#include "element_geometry.h"
 #include "legacy/bounding_client_rect.h"
 #include "legacy/element_attributes.h"
 #include "parent_node.h"
@@ -35,6 +37,30 @@ class Element : public ContainerNode {
   void setAttribute(const AtomicString&, const AtomicString& value);
   void setAttribute(const AtomicString&, const AtomicString& value, ExceptionState&);
   void removeAttribute(const AtomicString&, ExceptionState& exception_state);
+  // Called by ElementAttributes after an attribute was set or removed.
+  void AttributeChanged(const AtomicString& name, const AtomicString& value);
+  // Read an attribute from native side, without falling back to dart. Returns nullptr if it's not set.
+  const AtomicString* FastGetAttribute(const AtomicString& name) const;
+  // Attributes and inline style without creating them, nullptr if they were never set.
+  const ElementAttributes* GetElementAttributes() const { return attributes_.Get(); }
+  const CSSStyleDeclaration* InlineStyle() const { return cssom_wrapper_.Get(); }
+
+  AtomicString id() const;
+  void setId(const AtomicString& value, ExceptionState& exception_state);
+  AtomicString className() const;
+  void setClassName(const AtomicString& value, ExceptionState& exception_state);
+  const AtomicString& GetIdAttribute() const;
+  bool HasClass(const AtomicString& class_name) const;
+  const std::vector<AtomicString>& ClassNames() const;
+  DOMTokenList* classList();
+  // Set the class attribute from already split class names, used by DOMTokenList to skip parsing the value again.
+  void SetClassNames(std::vector<AtomicString> class_names, ExceptionState& exception_state);
+
+  Element* querySelector(const AtomicString& selectors, ExceptionState& exception_state);
+  std::vector<Element*> querySelectorAll(const AtomicString& selectors, ExceptionState& exception_state);
+  bool matches(const AtomicString& selectors, ExceptionState& exception_state);
+  Element* closest(const AtomicString& selectors, ExceptionState& exception_state);
+
   BoundingClientRect* getBoundingClientRect(ExceptionState& exception_state);
   void click(ExceptionState& exception_state);
   void scroll(ExceptionState& exception_state);
@@ -47,22 +73,35 @@ class Element : public ContainerNode {
   void scrollBy(double x, double y, ExceptionState& exception_state);
   void scrollBy(const std::shared_ptr<ScrollToOptions>& options, ExceptionState& exception_state);
 
+  double clientTop();
+  double clientLeft();
+  double clientWidth();
+  double clientHeight();
+  double scrollTop();
+  void setScrollTop(double value, ExceptionState& exception_state);
+  double scrollLeft();
+  void setScrollLeft(double value, ExceptionState& exception_state);
+  double scrollWidth();
+  double scrollHeight();
+
+  // Geometry is read from dart side at most once per layout: the first read queries this element together with its
+  // following siblings, later reads are served from the cache until Document::LayoutVersion() changes.
+  double GetGeometry(ElementGeometryField field);
+
   ScriptPromise toBlob(double device_pixel_ratio, ExceptionState& exception_state);
   ScriptPromise toBlob(ExceptionState& exception_state);
 
-  std::string outerHTML();
-  std::string innerHTML();
+  ScriptValue outerHTML();
+  ScriptValue innerHTML();
   void setInnerHTML(const AtomicString& value, ExceptionState& exception_state);
 
   bool HasTagName(const AtomicString&) const;
+  const AtomicString& LocalName() const { return tag_name_; }
   std::string nodeValue() const override;
   AtomicString tagName() const { return tag_name_.ToUpperSlow(ctx()); }
   std::string nodeName() const override;
   std::string nodeNameLowerCase() const;
 
-  std::vector<Element*> getElementsByClassName(const AtomicString& class_name, ExceptionState& exception_state);
-  std::vector<Element*> getElementsByTagName(const AtomicString& tag_name, ExceptionState& exception_state);
-
   CSSStyleDeclaration* style();
   CSSStyleDeclaration& EnsureCSSStyleDeclaration();
 
@@ -80,7 +119,11 @@ class Element : public ContainerNode {
   virtual void CloneNonAttributePropertiesFrom(const Element&, CloneChildrenFlag) {}
   virtual bool IsWidgetElement() const;
 
+  void InsertedInto(ContainerNode& insertion_point) override;
+  void RemovedFrom(ContainerNode& insertion_point) override;
+
   bool IsAttributeDefinedInternal(const AtomicString& key) const override;
+  NativeValue HandleCallFromDartSide(const NativeValue* native_method, int32_t argc, const NativeValue* argv) override;
   void Trace(GCVisitor* visitor) const override;
 
  protected:
@@ -100,10 +143,16 @@ class Element : public ContainerNode {
   void _notifyChildInsert();
   void _didModifyAttribute(const AtomicString& name, const AtomicString& oldId, const AtomicString& newId);
   void _beforeUpdateId(JSValue oldIdValue, JSValue newIdValue);
+  void UpdateClass(const AtomicString& class_value, std::vector<AtomicString> class_names);
+  NativeValue HandleSyncComputedAttributesFromDart(int32_t argc, const NativeValue* argv);
+  bool HasValidGeometry() const;
+  void UpdateGeometry(ExceptionState& exception_state);
 
   mutable std::unique_ptr<ElementData> element_data_;
+  std::unique_ptr<ElementGeometry> geometry_;
   Member<ElementAttributes> attributes_;
   Member<CSSStyleDeclaration> cssom_wrapper_;
+  Member<DOMTokenList> class_list_;
 };
 
 template <typename T>
@@ -4,9 +4,53 @@
  */
 
 #include "element_data.h"
+#include <algorithm>
+#include <utility>
 
 namespace webf {
 
-void ElementData::CopyWith(ElementData* other) {}
+static inline bool IsHTMLSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
 
-}  // namespace webf
\ No newline at end of file
+void ElementData::CopyWith(ElementData* other) {
+  id_for_style_resolution_ = other->id_for_style_resolution_;
+  class_ = other->class_;
+  class_names_ = other->class_names_;
+}
+
+void ElementData::SetClass(const AtomicString& class_value, std::vector<AtomicString> class_names) {
+  class_ = class_value;
+  class_names_ = std::move(class_names);
+}
+
+std::vector<AtomicString> ElementData::SplitClassNames(JSContext* ctx, const AtomicString& class_value) {
+  std::vector<AtomicString> class_names;
+  if (class_value.IsEmpty())
+    return class_names;
+
+  std::string string = class_value.ToStdString(ctx);
+  size_t start = 0;
+  while (start < string.length()) {
+    while (start < string.length() && IsHTMLSpace(string[start])) {
+      start++;
+    }
+    size_t end = start;
+    while (end < string.length() && !IsHTMLSpace(string[end])) {
+      end++;
+    }
+    if (end > start) {
+      AtomicString class_name = AtomicString(ctx, string.substr(start, end - start));
+      if (std::find(class_names.begin(), class_names.end(), class_name) == class_names.end())
+        class_names.emplace_back(std::move(class_name));
+    }
+    start = end;
+  }
+  return class_names;
+}
+
+bool ElementData::HasClass(const AtomicString& class_name) const {
+  return std::find(class_names_.begin(), class_names_.end(), class_name) != class_names_.end();
+}
+
+}  // namespace webf
@@ -6,16 +6,32 @@
 #ifndef WEBF_CORE_DOM_ELEMENT_DATA_H_
 #define WEBF_CORE_DOM_ELEMENT_DATA_H_
 
+#include <vector>
 #include "bindings/qjs/atomic_string.h"
 
 namespace webf {
 
+// Values of the id and class attributes, kept in parsed form for selector matching.
 class ElementData {
  public:
   void CopyWith(ElementData* other);
 
+  const AtomicString& IdForStyleResolution() const { return id_for_style_resolution_; }
+  void SetIdAttribute(const AtomicString& id) { id_for_style_resolution_ = id; }
+
+  const AtomicString& ClassAttribute() const { return class_; }
+  const std::vector<AtomicString>& ClassNames() const { return class_names_; }
+  // |class_names| are the tokens of |class_value|, see SplitClassNames().
+  void SetClass(const AtomicString& class_value, std::vector<AtomicString> class_names);
+  bool HasClass(const AtomicString& class_name) const;
+
+  // Split a class attribute value on HTML whitespace, duplicated names are dropped.
+  static std::vector<AtomicString> SplitClassNames(JSContext* ctx, const AtomicString& class_value);
+
  private:
+  AtomicString id_for_style_resolution_;
   AtomicString class_;
+  std::vector<AtomicString> class_names_;
 };
 
 }  // namespace webf
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_DOM_ELEMENT_GEOMETRY_H_
+#define BRIDGE_CORE_DOM_ELEMENT_GEOMETRY_H_
+
+#include <cinttypes>
+#include <cstddef>
+
+namespace webf {
+
+// The CSSOM View geometry of an element. Dart side writes the fields in this order for each element of a
+// getGeometryOfElements query, keep it in sync with Document.getGeometryOfElements.
+enum class ElementGeometryField : uint8_t {
+  // The border box relative to the viewport, see getBoundingClientRect().
+  kRectX,
+  kRectY,
+  kRectWidth,
+  kRectHeight,
+  kOffsetTop,
+  kOffsetLeft,
+  kOffsetWidth,
+  kOffsetHeight,
+  kClientTop,
+  kClientLeft,
+  kClientWidth,
+  kClientHeight,
+  kScrollTop,
+  kScrollLeft,
+  kScrollWidth,
+  kScrollHeight,
+  kCount,
+};
+
+constexpr size_t kElementGeometryFieldCount = static_cast<size_t>(ElementGeometryField::kCount);
+
+struct ElementGeometry {
+  double Get(ElementGeometryField field) const { return values[static_cast<size_t>(field)]; }
+
+  // Document::LayoutVersion() when the values were read.
+  uint64_t layout_version{0};
+  double values[kElementGeometryFieldCount]{};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_DOM_ELEMENT_GEOMETRY_H_
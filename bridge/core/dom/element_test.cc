@@ -3,6 +3,8 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 
+#include "binding_call_method_ids.h"
+#include "core/dom/document.h"
 #include "core/dom/legacy/bounding_client_rect.h"
 #include "gtest/gtest.h"
 #include "webf_test_env.h"
@@ -106,6 +108,60 @@ console.log(div.outerHTML, div.innerHTML, document.body.innerHTML);
   EXPECT_EQ(errorCalled, false);
 }
 
+TEST(Element, innerHTMLEscaping) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(),
+                 "<p title=\"a &amp; &quot;b&quot; <c>\">1 &lt; 2 &amp;&amp; 3 &gt; 2</p><br><script>a < b</script>"
+                 "<template><span>中文</span></template>");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let div = document.createElement('div');"
+      "let p = document.createElement('p');"
+      "p.setAttribute('title', 'a & \"b\" <c>');"
+      "p.appendChild(document.createTextNode('1 < 2 && 3 > 2'));"
+      "div.appendChild(p);"
+      "div.appendChild(document.createElement('br'));"
+      "let script = document.createElement('script');"
+      "script.appendChild(document.createTextNode('a < b'));"
+      "div.appendChild(script);"
+      "let template = document.createElement('template');"
+      "template.innerHTML = '<span>中文</span>';"
+      "div.appendChild(template);"
+      "console.log(div.innerHTML);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Element, outerHTMLOfDeepTree) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "true");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let root = document.createElement('div');"
+      "let node = root;"
+      "for (let i = 0; i < 2000; i++) { let child = document.createElement('div'); node.appendChild(child); "
+      "node = child; }"
+      "console.log(root.outerHTML === '<div>'.repeat(2001) + '</div>'.repeat(2001));";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
 TEST(Element, style) {
   bool static errorCalled = false;
   bool static logCalled = false;
@@ -162,4 +218,54 @@ TEST(Element, instanceofEventTarget) {
 
   EXPECT_EQ(errorCalled, false);
   EXPECT_EQ(logCalled, true);
-}
\ No newline at end of file
+}
+
+TEST(Element, geometryIsQueriedOncePerLayout) {
+  bool static errorCalled = false;
+  static std::vector<std::string> logs;
+  static int queries = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = bridge->GetExecutingContext();
+  NativeBindingObject* native_binding_object = context->document()->bindingObject();
+  // The value of each field is the index of the element in the query * 100 + the index of the field.
+  native_binding_object->invoke_bindings_methods_from_native =
+      [](const NativeBindingObject* binding_object, NativeValue* return_value, NativeValue* method, int32_t argc,
+         const NativeValue* argv) {
+        if (method->u.int64 != BindingMethodCallOperations::kInvokeMethod ||
+            method->uint32 != static_cast<uint32_t>(BindingMethodId::kgetGeometryOfElements))
+          return;
+        queries++;
+        auto* values = static_cast<double*>(argv[0].u.ptr);
+        for (int32_t i = 0; i < argc - 1; i++) {
+          for (size_t field = 0; field < kElementGeometryFieldCount; field++) {
+            values[i * kElementGeometryFieldCount + field] = i * 100 + field;
+          }
+        }
+      };
+
+  const char* code =
+      "let items = [];"
+      "for (let i = 0; i < 3; i++) {"
+      "  items.push(document.body.appendChild(document.createElement('div')));"
+      "}"
+      "console.log(items[0].offsetTop, items[1].offsetHeight, items[2].getBoundingClientRect().width,"
+      "  items[0].clientWidth);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(queries, 1);
+
+  const char* change = "items[1].style.width = '10px'; console.log(items[1].offsetTop, items[2].scrollTop);";
+  bridge->evaluateScript(change, strlen(change), "vm://", 0);
+  EXPECT_EQ(queries, 2);
+
+  native_binding_object->invoke_bindings_methods_from_native = nullptr;
+  EXPECT_EQ(errorCalled, false);
+  ASSERT_EQ(logs.size(), 2);
+  EXPECT_STREQ(logs[0].c_str(), "4 107 202 10");
+  EXPECT_STREQ(logs[1].c_str(), "4 112");
+}
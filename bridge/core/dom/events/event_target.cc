@@ -4,7 +4,7 @@
  */
 #include "event_target.h"
 #include <cstdint>
-#include "binding_call_methods.h"
+#include "binding_call_method_ids.h"
 #include "bindings/qjs/converter_impl.h"
 #include "event_factory.h"
 #include "native_value_converter.h"
@@ -217,8 +217,7 @@ bool EventTarget::AddEventListenerInternal(const AtomicString& event_type,
                                                               &listener_count);
 
   if (added && listener_count == 1) {
-    GetExecutingContext()->uiCommandBuffer()->addCommand(event_target_id_, UICommand::kAddEvent,
-                                                         std::move(event_type.ToNativeString(ctx())), nullptr);
+    GetExecutingContext()->uiCommandBuffer()->addCommand(event_target_id_, UICommand::kAddEvent, event_type, nullptr);
   }
 
   return added;
@@ -263,8 +262,8 @@ bool EventTarget::RemoveEventListenerInternal(const AtomicString& event_type,
   }
 
   if (listener_count == 0) {
-    GetExecutingContext()->uiCommandBuffer()->addCommand(event_target_id_, UICommand::kRemoveEvent,
-                                                         std::move(event_type.ToNativeString(ctx())), nullptr);
+    GetExecutingContext()->uiCommandBuffer()->addCommand(event_target_id_, UICommand::kRemoveEvent, event_type,
+                                                         nullptr);
   }
 
   return true;
@@ -283,9 +282,9 @@ NativeValue EventTarget::HandleCallFromDartSide(const NativeValue* native_method
                                                 int32_t argc,
                                                 const NativeValue* argv) {
   MemberMutationScope mutation_scope{GetExecutingContext()};
-  AtomicString method = NativeValueConverter<NativeTypeString>::FromNativeValue(ctx(), *native_method);
+  auto method = static_cast<BindingMethodId>(NativeValueConverter<NativeTypeInt64>::FromNativeValue(*native_method));
 
-  if (method == binding_call_methods::kdispatchEvent) {
+  if (method == BindingMethodId::kdispatchEvent) {
     return HandleDispatchEventFromDart(argc, argv);
   }
 
@@ -294,6 +293,8 @@ NativeValue EventTarget::HandleCallFromDartSide(const NativeValue* native_method
 
 NativeValue EventTarget::HandleDispatchEventFromDart(int32_t argc, const NativeValue* argv) {
   assert(argc == 2);
+  // Events from dart side are usually the result of user input, such as scrolling, which changes layout.
+  InvalidateLayout();
   AtomicString event_type = NativeValueConverter<NativeTypeString>::FromNativeValue(ctx(), argv[0]);
   RawEvent* raw_event = NativeValueConverter<NativeTypePointer<RawEvent>>::FromNativeValue(argv[1]);
 
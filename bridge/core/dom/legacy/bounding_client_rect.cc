@@ -4,21 +4,28 @@
  */
 
 #include "bounding_client_rect.h"
+#include <algorithm>
 #include "core/executing_context.h"
 
 namespace webf {
 
-BoundingClientRect* BoundingClientRect::Create(ExecutingContext* context, NativeBindingObject* native_binding_object) {
-  return MakeGarbageCollected<BoundingClientRect>(context, native_binding_object);
+BoundingClientRect* BoundingClientRect::Create(ExecutingContext* context,
+                                               double x,
+                                               double y,
+                                               double width,
+                                               double height) {
+  return MakeGarbageCollected<BoundingClientRect>(context, x, y, width, height);
 }
 
-BoundingClientRect::BoundingClientRect(ExecutingContext* context, NativeBindingObject* native_binding_object)
-    : ScriptWrappable(context->ctx()), BindingObject(context, native_binding_object) {}
-
-NativeValue BoundingClientRect::HandleCallFromDartSide(const NativeValue* method,
-                                                       int32_t argc,
-                                                       const NativeValue* argv) {
-  return Native_NewNull();
-}
+BoundingClientRect::BoundingClientRect(ExecutingContext* context, double x, double y, double width, double height)
+    : ScriptWrappable(context->ctx()),
+      x_(x),
+      y_(y),
+      width_(width),
+      height_(height),
+      top_(std::min(y, y + height)),
+      right_(std::max(x, x + width)),
+      bottom_(std::max(y, y + height)),
+      left_(std::min(x, x + width)) {}
 
 }  // namespace webf
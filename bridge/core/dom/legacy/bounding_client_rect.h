@@ -6,24 +6,21 @@
 #ifndef BRIDGE_CORE_DOM_LEGACY_BOUNDING_CLIENT_RECT_H_
 #define BRIDGE_CORE_DOM_LEGACY_BOUNDING_CLIENT_RECT_H_
 
-#include "bindings/qjs/exception_state.h"
 #include "bindings/qjs/script_wrappable.h"
-#include "core/binding_object.h"
 
 namespace webf {
 
 class ExecutingContext;
 
-class BoundingClientRect : public ScriptWrappable, public BindingObject {
+// A snapshot of the border box of an element, built from the geometry cached by Element, it has no dart side object.
+class BoundingClientRect : public ScriptWrappable {
   DEFINE_WRAPPERTYPEINFO();
 
  public:
   using ImplType = BoundingClientRect*;
   BoundingClientRect() = delete;
-  static BoundingClientRect* Create(ExecutingContext* context, NativeBindingObject* native_binding_object);
-  explicit BoundingClientRect(ExecutingContext* context, NativeBindingObject* native_binding_object);
-
-  NativeValue HandleCallFromDartSide(const NativeValue* method, int32_t argc, const NativeValue* argv) override;
+  static BoundingClientRect* Create(ExecutingContext* context, double x, double y, double width, double height);
+  explicit BoundingClientRect(ExecutingContext* context, double x, double y, double width, double height);
 
   double x() const { return x_; }
   double y() const { return y_; }
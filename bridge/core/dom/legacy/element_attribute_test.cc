@@ -2,6 +2,8 @@
  * Copyright (C) 2019-2022 The Kraken authors. All rights reserved.
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
+#include "binding_call_method_ids.h"
+#include "core/dom/document.h"
 #include "gtest/gtest.h"
 #include "webf_test_env.h"
 
@@ -25,4 +27,49 @@ TEST(Element, overrideAttribute) {
   bridge->evaluateScript(code, strlen(code), "vm://", 0);
   EXPECT_EQ(errorCalled, false);
   EXPECT_EQ(logCalled, false);
-}
\ No newline at end of file
+}
+TEST(Element, missingAttributesAreAnsweredNatively) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  static std::vector<int64_t> properties;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "  dart 1");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = bridge->GetExecutingContext();
+  const char* code = "let section = document.createElement('section'); document.body.appendChild(section);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  auto* section = To<Element>(context->document()->body()->firstChild());
+  section->bindingObject()->invoke_bindings_methods_from_native =
+      [](const NativeBindingObject* binding_object, NativeValue* return_value, NativeValue* method, int32_t argc,
+         const NativeValue* argv) {
+        if (method->u.int64 == BindingMethodCallOperations::kGetProperty) {
+          properties.emplace_back(argv[0].u.int64);
+          *return_value = Native_NewCString("dart");
+        }
+      };
+
+  // What dart side sends when it creates the first section element.
+  NativeValue method = Native_NewInt64(static_cast<int64_t>(BindingMethodId::ksyncComputedAttributes));
+  NativeValue names[] = {Native_NewCString("href")};
+  NativeValue attributes = Native_NewList(1, names);
+  section->HandleCallFromDartSide(&method, 1, &attributes);
+
+  const char* read =
+      "section.setAttribute('data-id', '1');"
+      "console.log(section.getAttribute('data-x'), section.getAttribute('aria-label'), section.getAttribute('href'),"
+      "  section.getAttribute('data-id'));";
+  bridge->evaluateScript(read, strlen(read), "vm://", 0);
+  section->bindingObject()->invoke_bindings_methods_from_native = nullptr;
+
+  ASSERT_EQ(properties.size(), 1);
+  EXPECT_EQ(properties[0], static_cast<int64_t>(BindingMethodId::khref));
+  EXPECT_EQ(context->AvoidedAttributeFallbackCount(), 2);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
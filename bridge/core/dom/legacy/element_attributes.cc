@@ -6,7 +6,9 @@
 #include "element_attributes.h"
 #include "bindings/qjs/exception_state.h"
 #include "built_in_string.h"
+#include "core/dart_context.h"
 #include "core/dom/element.h"
+#include "element_attribute_names.h"
 #include "foundation/native_value_converter.h"
 
 namespace webf {
@@ -18,6 +20,19 @@ static inline bool IsNumberIndex(const StringView& name) {
   return f >= '0' && f <= '9';
 }
 
+// Dart side receives the style attribute as the changes of the inline style, see Element::AttributeChanged().
+bool ElementAttributes::IsAppliedAsInlineStyle(const AtomicString& name) const {
+  return name == element_attribute_names::kstyle && element_->InlineStyle() != nullptr;
+}
+
+// Markup and script set attributes are always stored in native side. Until dart side sent the attributes it computes
+// for the tag, every attribute may be one of them.
+bool ElementAttributes::MayBeComputedByDart(const AtomicString& name) const {
+  const auto* computed_attributes =
+      GetExecutingContext()->dartContext()->EnsureData()->GetDartComputedAttributes(element_->LocalName());
+  return computed_attributes == nullptr || computed_attributes->count(name) > 0;
+}
+
 ElementAttributes::ElementAttributes(Element* element) : ScriptWrappable(element->ctx()), element_(element) {}
 
 AtomicString ElementAttributes::getAttribute(const AtomicString& name, ExceptionState& exception_state) {
@@ -27,10 +42,15 @@ AtomicString ElementAttributes::getAttribute(const AtomicString& name, Exception
     return AtomicString::Empty();
   }
 
-  AtomicString value = attributes_[name];
+  auto it = attributes_.find(name);
+  AtomicString value = it != attributes_.end() ? it->second : AtomicString::Empty();
 
-  // Fallback to directly FFI access to dart.
+  // Fallback to directly FFI access to dart, for the attributes which dart side may compute.
   if (value.IsEmpty()) {
+    if (!MayBeComputedByDart(name)) {
+      GetExecutingContext()->RecordAvoidedAttributeFallback();
+      return value;
+    }
     NativeValue dart_result = element_->GetBindingProperty(name, exception_state);
     if (dart_result.tag == NativeTag::TAG_STRING) {
       return NativeValueConverter<NativeTypeString>::FromNativeValue(element_->ctx(), dart_result);
@@ -53,12 +73,13 @@ bool ElementAttributes::setAttribute(const AtomicString& name,
   }
 
   attributes_[name] = value;
+  element_->AttributeChanged(name, value);
 
-  std::unique_ptr<NativeString> args_01 = name.ToNativeString(ctx());
-  std::unique_ptr<NativeString> args_02 = value.ToNativeString(ctx());
+  if (IsAppliedAsInlineStyle(name))
+    return true;
 
-  GetExecutingContext()->uiCommandBuffer()->addCommand(element_->eventTargetId(), UICommand::kSetAttribute,
-                                                       std::move(args_01), std::move(args_02), nullptr);
+  GetExecutingContext()->uiCommandBuffer()->addCommand(element_->eventTargetId(), UICommand::kSetAttribute, name,
+                                                       value, nullptr);
 
   return true;
 }
@@ -75,10 +96,18 @@ bool ElementAttributes::hasAttribute(const AtomicString& name, ExceptionState& e
 
 void ElementAttributes::removeAttribute(const AtomicString& name, ExceptionState& exception_state) {
   attributes_.erase(name);
+  element_->AttributeChanged(name, AtomicString::Empty());
+
+  if (IsAppliedAsInlineStyle(name))
+    return;
 
-  std::unique_ptr<NativeString> args_01 = name.ToNativeString(ctx());
-  GetExecutingContext()->uiCommandBuffer()->addCommand(element_->eventTargetId(), UICommand::kRemoveAttribute,
-                                                       std::move(args_01), nullptr);
+  GetExecutingContext()->uiCommandBuffer()->addCommand(element_->eventTargetId(), UICommand::kRemoveAttribute, name,
+                                                       nullptr);
+}
+
+const AtomicString* ElementAttributes::FindAttribute(const AtomicString& name) const {
+  auto it = attributes_.find(name);
+  return it != attributes_.end() ? &it->second : nullptr;
 }
 
 void ElementAttributes::CopyWith(ElementAttributes* attributes) {
@@ -87,17 +116,6 @@ void ElementAttributes::CopyWith(ElementAttributes* attributes) {
   }
 }
 
-std::string ElementAttributes::ToString() {
-  std::string s;
-
-  for (auto& attr : attributes_) {
-    s += attr.first.ToStdString(ctx()) + "=";
-    s += "\"" + attr.second.ToStdString(ctx()) + "\"";
-  }
-
-  return s;
-}
-
 bool ElementAttributes::IsEquivalent(const ElementAttributes& other) const {
   if (attributes_.size() != other.attributes_.size())
     return false;
@@ -10,7 +10,6 @@
 #include "bindings/qjs/atomic_string.h"
 #include "bindings/qjs/cppgc/member.h"
 #include "bindings/qjs/script_wrappable.h"
-#include "space_split_string.h"
 
 namespace webf {
 
@@ -32,14 +31,20 @@ class ElementAttributes : public ScriptWrappable {
   bool setAttribute(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state);
   bool hasAttribute(const AtomicString& name, ExceptionState& exception_state);
   void removeAttribute(const AtomicString& name, ExceptionState& exception_state);
+  const AtomicString* FindAttribute(const AtomicString& name) const;
   void CopyWith(ElementAttributes* attributes);
-  std::string ToString();
+  const std::unordered_map<AtomicString, AtomicString, AtomicString::KeyHasher>& Attributes() const {
+    return attributes_;
+  }
 
   bool IsEquivalent(const ElementAttributes& other) const;
 
   void Trace(GCVisitor* visitor) const override;
 
  private:
+  bool IsAppliedAsInlineStyle(const AtomicString& name) const;
+  bool MayBeComputedByDart(const AtomicString& name) const;
+
   Member<Element> element_;
   std::unordered_map<AtomicString, AtomicString, AtomicString::KeyHasher> attributes_;
 };
@@ -23,3 +23,25 @@
  */
 
 #include "live_node_list_base.h"
+
+namespace webf {
+
+ContainerNode& LiveNodeListBase::RootNode() const {
+  if (IsRootedAtTreeScope() && owner_node_->IsInTreeScope())
+    return owner_node_->GetTreeScope().RootNode();
+  return *owner_node_;
+}
+
+void LiveNodeListBase::InvalidateCacheIfNeeded() const {
+  Document& document = GetDocument();
+  uint64_t dom_tree_version = document.DomTreeVersion();
+  uint64_t attribute_version = document.NodeListAttributeVersion(InvalidationType());
+  if (dom_tree_version == cached_dom_tree_version_ && attribute_version == cached_attribute_version_)
+    return;
+
+  InvalidateCache();
+  cached_dom_tree_version_ = dom_tree_version;
+  cached_attribute_version_ = attribute_version;
+}
+
+}  // namespace webf
@@ -39,7 +39,11 @@ enum class NodeListSearchRoot {
   kTreeScope,
 };
 
-class LiveNodeListBase : public GarbageCollected<LiveNodeListBase> {
+// Base of the live collections (e.g. HTMLCollection), which are evaluated natively on every access.
+//
+// Caches are built lazily and dropped once the document's DOM tree version, or the version of the attributes
+// selected by InvalidationType(), moved on since they were built.
+class LiveNodeListBase {
  public:
   explicit LiveNodeListBase(ContainerNode* owner_node,
                             NodeListSearchRoot search_root,
@@ -70,10 +74,12 @@ class LiveNodeListBase : public GarbageCollected<LiveNodeListBase> {
 
   virtual void InvalidateCache(Document* old_document = nullptr) const = 0;
   void InvalidateCacheForAttribute(const AtomicString&) const;
+  // Drop the cache if the tree or a relevant attribute was changed since it was built.
+  void InvalidateCacheIfNeeded() const;
 
   static bool ShouldInvalidateTypeOnAttributeChange(NodeListInvalidationType, const AtomicString&);
 
-  void Trace(GCVisitor* visitor) const override { visitor->Trace(owner_node_); }
+  virtual void Trace(GCVisitor* visitor) const { visitor->Trace(owner_node_); }
 
  protected:
   Document& GetDocument() const { return owner_node_->GetDocument(); }
@@ -98,6 +104,8 @@ class LiveNodeListBase : public GarbageCollected<LiveNodeListBase> {
   const unsigned search_root_ : 1;
   const unsigned invalidation_type_ : 4;
   const unsigned collection_type_ : 5;
+  mutable uint64_t cached_dom_tree_version_{0};
+  mutable uint64_t cached_attribute_version_{0};
 };
 
 FORCE_INLINE bool LiveNodeListBase::ShouldInvalidateTypeOnAttributeChange(NodeListInvalidationType type,
@@ -330,6 +330,8 @@ void Node::RemovedFrom(ContainerNode& insertion_point) {
   if (insertion_point.isConnected()) {
     ClearFlag(kIsConnectedFlag);
     insertion_point.GetDocument().DecrementNodeCount();
+    // Detached nodes are freed by QuickJS GC, which only sees the references held by JS objects.
+    EnsureQuickJSObject();
   }
 }
 
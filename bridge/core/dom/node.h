@@ -311,6 +311,10 @@ class Node : public EventTarget {
 
   void SetTreeScope(TreeScope* scope) { tree_scope_ = scope; }
 
+  // A node connected to the document is kept alive by its tree, the JS object is created when the node is exposed to
+  // script or removed from the document.
+  bool CanDeferQuickJSObject() const override { return true; }
+
   Node(ExecutingContext* context, TreeScope*, ConstructionType);
   Node() = delete;
   ~Node();
@@ -36,6 +36,13 @@ uint32_t ScriptAnimationController::RegisterFrameCallback(const std::shared_ptr<
     return -1;
   }
 
+  if (!context->IsBoundToContextId()) {
+    exception_state.ThrowException(
+        context->ctx(), ErrorType::InternalError,
+        "Failed to execute 'requestAnimationFrame': the page is not bound to a context id yet.");
+    return -1;
+  }
+
   uint32_t requestId = context->dartMethodPtr()->requestAnimationFrame(frame_callback.get(), context->contextId(),
                                                                        handleRAFTransientCallback);
 
@@ -48,6 +55,10 @@ uint32_t ScriptAnimationController::RegisterFrameCallback(const std::shared_ptr<
 void ScriptAnimationController::CancelFrameCallback(ExecutingContext* context,
                                                     uint32_t callbackId,
                                                     ExceptionState& exception_state) {
+  // Frame callbacks can't be requested before the page is bound, there is nothing to cancel.
+  if (!context->IsBoundToContextId())
+    return;
+
   if (context->dartMethodPtr()->cancelAnimationFrame == nullptr) {
     exception_state.ThrowException(
         context->ctx(), ErrorType::InternalError,
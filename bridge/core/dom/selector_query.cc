@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "selector_query.h"
+#include <unordered_set>
+#include "bindings/qjs/exception_state.h"
+#include "core/css/parser/css_selector_parser.h"
+#include "core/css/selector_checker.h"
+#include "element_traversal.h"
+
+namespace webf {
+
+// Unsupported selectors are cached as well, so that they are parsed only once before falling back to dart side.
+static const size_t kMaximumSelectorQueryCacheSize = 256;
+
+// Returns a class the element matched by |selector| must have, or nullptr.
+static const AtomicString* FindRequiredClass(const CSSSelectorList::ComplexSelector& selector) {
+  // The rightmost compound selector comes first and ends with the first combinator.
+  for (const CSSSelector& simple_selector : selector) {
+    if (simple_selector.Match() == CSSSelector::kClass)
+      return &simple_selector.Value();
+    if (simple_selector.Relation() != CSSSelector::kSubSelector)
+      break;
+  }
+  return nullptr;
+}
+
+SelectorQuery::SelectorQuery(std::unique_ptr<CSSSelectorList> selector_list)
+    : selector_list_(std::move(selector_list)) {
+  for (const CSSSelectorList::ComplexSelector& selector : selector_list_->Selectors()) {
+    const AtomicString* required_class = FindRequiredClass(selector);
+    if (required_class == nullptr) {
+      required_classes_.clear();
+      return;
+    }
+    required_classes_.emplace_back(*required_class);
+  }
+}
+
+bool SelectorQuery::Matches(Element& element) const {
+  return SelectorChecker::Match(*selector_list_, element, &element);
+}
+
+Element* SelectorQuery::Closest(Element& element) const {
+  for (Element* current = &element; current != nullptr; current = current->parentElement()) {
+    if (SelectorChecker::Match(*selector_list_, *current, &element))
+      return current;
+  }
+  return nullptr;
+}
+
+Element* SelectorQuery::QueryFirst(ContainerNode& root) const {
+  std::unordered_set<Element*> matches;
+  if (CollectMatchesByClass(root, matches)) {
+    if (matches.size() <= 1)
+      return matches.empty() ? nullptr : *matches.begin();
+    // Find the first one in tree order.
+    for (Element* element = ElementTraversal::FirstWithin(root); element != nullptr;
+         element = ElementTraversal::Next(*element, &root)) {
+      if (matches.count(element))
+        return element;
+    }
+    return nullptr;
+  }
+
+  for (Element* element = ElementTraversal::FirstWithin(root); element != nullptr;
+       element = ElementTraversal::Next(*element, &root)) {
+    if (SelectorChecker::Match(*selector_list_, *element, &root))
+      return element;
+  }
+  return nullptr;
+}
+
+std::vector<Element*> SelectorQuery::QueryAll(ContainerNode& root) const {
+  std::vector<Element*> result;
+  std::unordered_set<Element*> matches;
+  if (CollectMatchesByClass(root, matches)) {
+    if (matches.size() <= 1)
+      return {matches.begin(), matches.end()};
+    // Sort the matches in tree order, the traversal stops at the last one.
+    result.reserve(matches.size());
+    for (Element* element = ElementTraversal::FirstWithin(root); element != nullptr && result.size() < matches.size();
+         element = ElementTraversal::Next(*element, &root)) {
+      if (matches.count(element))
+        result.emplace_back(element);
+    }
+    return result;
+  }
+
+  for (Element* element = ElementTraversal::FirstWithin(root); element != nullptr;
+       element = ElementTraversal::Next(*element, &root)) {
+    if (SelectorChecker::Match(*selector_list_, *element, &root))
+      result.emplace_back(element);
+  }
+  return result;
+}
+
+bool SelectorQuery::CollectMatchesByClass(ContainerNode& root, std::unordered_set<Element*>& matches) const {
+  if (required_classes_.empty() || !root.isConnected())
+    return false;
+
+  TreeScope& tree_scope = root.GetTreeScope();
+  std::vector<const std::unordered_set<Element*>*> candidate_sets;
+  size_t candidate_count = 0;
+  for (const AtomicString& class_name : required_classes_) {
+    const std::unordered_set<Element*>* candidates = tree_scope.ElementsWithClass(class_name);
+    if (candidates == nullptr)
+      continue;
+    candidate_sets.emplace_back(candidates);
+    candidate_count += candidates->size();
+  }
+
+  // Every element of the tree scope is below its root node, so the candidates only need to be checked against a
+  // subtree root. Traversing a subtree smaller than the candidate set is cheaper than checking the candidates, which
+  // is counted with a traversal that stops once it reaches |candidate_count|.
+  bool is_scope_root = &root == &tree_scope.RootNode();
+  if (!is_scope_root) {
+    size_t subtree_size = 0;
+    for (Element* element = ElementTraversal::FirstWithin(root); element != nullptr && subtree_size < candidate_count;
+         element = ElementTraversal::Next(*element, &root)) {
+      subtree_size++;
+    }
+    if (subtree_size < candidate_count)
+      return false;
+  }
+
+  matches.reserve(candidate_count);
+  for (const std::unordered_set<Element*>* candidates : candidate_sets) {
+    for (Element* candidate : *candidates) {
+      // An element may be found with the class of another complex selector as well.
+      if (matches.count(candidate))
+        continue;
+      if (!is_scope_root && (candidate == &root || !candidate->IsDescendantOf(&root)))
+        continue;
+      if (SelectorChecker::Match(*selector_list_, *candidate, &root))
+        matches.emplace(candidate);
+    }
+  }
+  return true;
+}
+
+SelectorQuery* SelectorQueryCache::Add(JSContext* ctx, const AtomicString& selectors, ExceptionState& exception_state) {
+  auto it = entries_.find(selectors);
+  if (it != entries_.end()) {
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    return it->second.query.get();
+  }
+
+  CSSSelectorParser::ParseResult result;
+  std::unique_ptr<CSSSelectorList> selector_list =
+      CSSSelectorParser::ParseSelectorList(ctx, selectors.ToStdString(ctx), &result);
+  if (result == CSSSelectorParser::ParseResult::kInvalid) {
+    exception_state.ThrowException(ctx, ErrorType::SyntaxError,
+                                   "'" + selectors.ToStdString(ctx) + "' is not a valid selector.");
+    return nullptr;
+  }
+
+  if (entries_.size() >= kMaximumSelectorQueryCacheSize) {
+    auto least_recently_used = entries_.find(*lru_.back());
+    lru_.pop_back();
+    entries_.erase(least_recently_used);
+  }
+
+  std::unique_ptr<SelectorQuery> query;
+  if (selector_list != nullptr)
+    query = std::make_unique<SelectorQuery>(std::move(selector_list));
+  SelectorQuery* raw_query = query.get();
+  auto inserted = entries_.emplace(selectors, Entry{std::move(query), {}}).first;
+  lru_.emplace_front(&inserted->first);
+  inserted->second.lru_position = lru_.begin();
+  return raw_query;
+}
+
+}  // namespace webf
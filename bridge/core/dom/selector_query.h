@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_DOM_SELECTOR_QUERY_H_
+#define BRIDGE_CORE_DOM_SELECTOR_QUERY_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "core/css/css_selector.h"
+
+namespace webf {
+
+class ContainerNode;
+class Element;
+class ExceptionState;
+
+// Evaluate a compiled selector list against the native DOM tree, without calling dart side.
+class SelectorQuery {
+ public:
+  explicit SelectorQuery(std::unique_ptr<CSSSelectorList> selector_list);
+
+  bool Matches(Element& element) const;
+  Element* Closest(Element& element) const;
+  Element* QueryFirst(ContainerNode& root) const;
+  std::vector<Element*> QueryAll(ContainerNode& root) const;
+
+ private:
+  // When every complex selector requires a class on the matched element, the candidates are taken from the class
+  // index of the tree scope instead of traversing |root|. Returns false when the index can not be used or |root| has
+  // fewer elements than the candidates, otherwise |matches| holds the matched elements in no particular order.
+  bool CollectMatchesByClass(ContainerNode& root, std::unordered_set<Element*>& matches) const;
+
+  std::unique_ptr<CSSSelectorList> selector_list_;
+  // One class of the rightmost compound selector for each complex selector, empty when one of them has none.
+  std::vector<AtomicString> required_classes_;
+};
+
+// Compiled selectors of a document, keyed by the selector string. When the cache is full, the least recently used
+// entry is evicted.
+class SelectorQueryCache {
+ public:
+  // Returns nullptr when the selectors could not be evaluated in native side and should be handled by dart side.
+  // Invalid selectors throw a SyntaxError.
+  SelectorQuery* Add(JSContext* ctx, const AtomicString& selectors, ExceptionState& exception_state);
+
+ private:
+  struct Entry {
+    // Null when the selectors are handled by dart side.
+    std::unique_ptr<SelectorQuery> query;
+    // Position of the entry in lru_.
+    std::list<const AtomicString*>::iterator lru_position;
+  };
+
+  std::unordered_map<AtomicString, Entry, AtomicString::KeyHasher> entries_;
+  // Keys of entries_, the most recently used first.
+  std::list<const AtomicString*> lru_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_DOM_SELECTOR_QUERY_H_
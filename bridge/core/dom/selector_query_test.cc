@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+static const char* kSelectorTestTree =
+    "let container = document.createElement('div');"
+    "container.id = 'container';"
+    "container.innerHTML = '<ul class=\"list\"><li class=\"item first\">1</li>"
+    "<li class=\"item\" data-index=\"2\">2</li>"
+    "<li class=\"item last\" data-index=\"3\" lang=\"en-US\">3</li></ul><p></p><span>text</span>';"
+    "document.body.appendChild(container);";
+
+TEST(SelectorQuery, querySelector) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "3 2 3 1 3 2");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  bridge->evaluateScript(kSelectorTestTree, strlen(kSelectorTestTree), "vm://", 0);
+  const char* code =
+      "console.log("
+      "document.querySelectorAll('#container ul > li.item').length,"
+      "document.querySelector('li[data-index]:not(.last)').textContent,"
+      "document.querySelector('li:nth-child(2n+1):last-of-type').textContent,"
+      "container.querySelector(':scope > ul li').textContent,"
+      "container.querySelector('[lang|=en]').textContent,"
+      "container.querySelectorAll('li + li, p:empty ~ span').length - 1"
+      ");";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, matchesAndClosest) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "true false true container null");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  bridge->evaluateScript(kSelectorTestTree, strlen(kSelectorTestTree), "vm://", 0);
+  const char* code =
+      "let last = document.querySelector('.last');"
+      "console.log("
+      "last.matches('ul.list > .item[data-index=\"3\"]'),"
+      "last.matches('.first'),"
+      "last.closest('ul') === document.querySelector('.list'),"
+      "last.closest('div').id,"
+      "last.closest('p')"
+      ");";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, followClassAndIdChanges) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "0 1 true false true");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let div = document.createElement('div');"
+      "document.body.appendChild(div);"
+      "let before = document.querySelectorAll('.a.b').length;"
+      "div.className = 'b  a';"
+      "let after = document.querySelectorAll('.a.b').length;"
+      "div.id = 'foo';"
+      "let byId = div.matches('#foo');"
+      "div.removeAttribute('id');"
+      "console.log(before, after, byId, div.matches('#foo'), div.cloneNode().matches('.a'));";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, queryByClassIndex) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "1,3 2 0 3 null 1 2");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  bridge->evaluateScript(kSelectorTestTree, strlen(kSelectorTestTree), "vm://", 0);
+  const char* code =
+      "let items = container.querySelectorAll('.first, ul > .last').map(e => e.textContent).join(',');"
+      "let second = document.querySelectorAll('li')[1];"
+      "second.classList.add('selected');"
+      "let selected = document.querySelector('.selected').textContent;"
+      "let detached = container.querySelector('ul').cloneNode(true);"
+      "let inFragment = detached.querySelectorAll('.selected').length;"
+      "second.className = 'item';"
+      "document.querySelectorAll('.last')[0].classList.replace('last', 'selected');"
+      "let replaced = document.querySelector('li.selected').textContent;"
+      "container.remove();"
+      "console.log(items, selected, inFragment - 1, replaced, document.querySelector('.selected'),"
+      "  container.querySelectorAll('.item.selected').length, detached.querySelectorAll('.item:not(.first)').length);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, invalidSelectorThrowSyntaxError) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "SyntaxError");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "try {"
+      "  document.querySelector('div >');"
+      "} catch (e) {"
+      "  console.log(e.name);"
+      "}";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, attributeNamesAreCaseInsensitive) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "2 3 true");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  bridge->evaluateScript(kSelectorTestTree, strlen(kSelectorTestTree), "vm://", 0);
+  const char* code =
+      "console.log("
+      "document.querySelectorAll('[DATA-INDEX]').length,"
+      "document.querySelector('li[Data-Index=\"3\"]').textContent,"
+      "document.querySelector('.last').matches('[LANG|=en]')"
+      ");";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, nthExpressions) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "2 3 0 SyntaxError SyntaxError");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  bridge->evaluateScript(kSelectorTestTree, strlen(kSelectorTestTree), "vm://", 0);
+  const char* code =
+      "function syntaxError(selector) {"
+      "  try { document.querySelector(selector); } catch (e) { return e.name; }"
+      "  return 'none';"
+      "}"
+      "console.log("
+      "document.querySelectorAll('li:nth-child( 2n + 1 )').length,"
+      "document.querySelectorAll('li:nth-child(n-99999999999)').length,"
+      "document.querySelectorAll('li:nth-child(-n-99999999999)').length,"
+      "syntaxError('li:nth-child(2 n)'),"
+      "syntaxError('li:nth-child(2n+ 1 0)')"
+      ");";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
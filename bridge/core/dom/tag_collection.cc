@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "tag_collection.h"
+#include "core/dom/element.h"
+
+namespace webf {
+
+TagCollection::TagCollection(ContainerNode& root_node, const AtomicString& qualified_name)
+    : HTMLCollection(root_node, kTagCollectionType, kDoNotInvalidateOnAttributeChanges),
+      qualified_name_(qualified_name),
+      lower_qualified_name_(qualified_name.ToLowerSlow(root_node.ctx())),
+      match_all_(qualified_name.ToStdString(root_node.ctx()) == "*") {}
+
+bool TagCollection::ElementMatches(const Element& element) const {
+  if (match_all_)
+    return true;
+  return element.HasTagName(qualified_name_) || element.HasTagName(lower_qualified_name_);
+}
+
+}  // namespace webf
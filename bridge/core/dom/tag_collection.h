@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_DOM_TAG_COLLECTION_H_
+#define BRIDGE_CORE_DOM_TAG_COLLECTION_H_
+
+#include "core/html/legacy/html_collection.h"
+
+namespace webf {
+
+// The live collection returned by getElementsByTagName(), "*" matches all elements.
+class TagCollection final : public HTMLCollection {
+ public:
+  TagCollection(ContainerNode& root_node, const AtomicString& qualified_name);
+
+ private:
+  bool ElementMatches(const Element&) const override;
+
+  AtomicString qualified_name_;
+  // Elements created by the parser and document.createElement('div') use the lower case tag name.
+  AtomicString lower_qualified_name_;
+  bool match_all_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_DOM_TAG_COLLECTION_H_
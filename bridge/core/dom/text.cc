@@ -30,9 +30,8 @@ std::string Text::nodeName() const {
 
 Node* Text::Clone(Document& document, CloneChildrenFlag flag) const {
   Node* copy = Create(document, data());
-  std::unique_ptr<NativeString> args_01 = stringToNativeString(std::to_string(copy->eventTargetId()));
-  GetExecutingContext()->uiCommandBuffer()->addCommand(eventTargetId(), UICommand::kCloneNode, std::move(args_01),
-                                                       nullptr);
+  GetExecutingContext()->uiCommandBuffer()->addCommand(eventTargetId(), UICommand::kCloneNode,
+                                                       std::to_string(copy->eventTargetId()), nullptr);
   return copy;
 }
 
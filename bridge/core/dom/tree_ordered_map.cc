@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "tree_ordered_map.h"
+#include "element_traversal.h"
+#include "tree_scope.h"
+
+namespace webf {
+
+void TreeOrderedMap::Add(const AtomicString& key, Element& element) {
+  assert(!key.IsEmpty());
+  auto it = map_.find(key);
+  if (it == map_.end()) {
+    map_.emplace(key, MapEntry{&element, 1});
+    return;
+  }
+
+  // The new element may come before the cached one, look it up again on demand.
+  it->second.element = nullptr;
+  it->second.count++;
+}
+
+void TreeOrderedMap::Remove(const AtomicString& key, Element& element) {
+  auto it = map_.find(key);
+  if (it == map_.end())
+    return;
+
+  assert(it->second.count > 0);
+  if (it->second.count == 1) {
+    map_.erase(it);
+    return;
+  }
+
+  if (it->second.element == &element)
+    it->second.element = nullptr;
+  it->second.count--;
+}
+
+bool TreeOrderedMap::ContainsMultiple(const AtomicString& key) const {
+  auto it = map_.find(key);
+  return it != map_.end() && it->second.count > 1;
+}
+
+Element* TreeOrderedMap::GetElementById(const AtomicString& key, const TreeScope& scope) const {
+  auto it = map_.find(key);
+  if (it == map_.end())
+    return nullptr;
+
+  MapEntry& entry = it->second;
+  if (entry.element != nullptr)
+    return entry.element;
+
+  for (Element* element = ElementTraversal::FirstWithin(scope.RootNode()); element != nullptr;
+       element = ElementTraversal::Next(*element)) {
+    if (element->GetIdAttribute() == key) {
+      entry.element = element;
+      return element;
+    }
+  }
+  // The map is updated by every insertion, removal and id change, so the element is always found.
+  assert(false);
+  return nullptr;
+}
+
+}  // namespace webf
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_DOM_TREE_ORDERED_MAP_H_
+#define BRIDGE_CORE_DOM_TREE_ORDERED_MAP_H_
+
+#include <unordered_map>
+#include "bindings/qjs/atomic_string.h"
+
+namespace webf {
+
+class Element;
+class TreeScope;
+
+// Map a key (e.g. the id attribute) to the connected elements which have it, and answer which one comes first in
+// tree order.
+//
+// Only the number of elements for each key is stored. The first element is cached, when it's unknown (more than
+// one element has the key and the cached one was removed) the tree scope is traversed to find it again. Duplicated
+// ids are rare, so most lookups are a single hash lookup.
+class TreeOrderedMap {
+ public:
+  void Add(const AtomicString& key, Element& element);
+  void Remove(const AtomicString& key, Element& element);
+
+  bool Contains(const AtomicString& key) const { return map_.count(key) > 0; }
+  bool ContainsMultiple(const AtomicString& key) const;
+
+  // Returns the first element with |key| as its id in tree order.
+  Element* GetElementById(const AtomicString& key, const TreeScope& scope) const;
+
+ private:
+  struct MapEntry {
+    Element* element;
+    unsigned count;
+  };
+
+  mutable std::unordered_map<AtomicString, MapEntry, AtomicString::KeyHasher> map_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_DOM_TREE_ORDERED_MAP_H_
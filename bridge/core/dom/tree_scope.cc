@@ -12,4 +12,36 @@ TreeScope::TreeScope(Document& document) : root_node_(&document), document_(&doc
   root_node_->SetTreeScope(this);
 }
 
+Element* TreeScope::getElementById(const AtomicString& element_id) const {
+  if (element_id.IsEmpty())
+    return nullptr;
+  return elements_by_id_.GetElementById(element_id, *this);
+}
+
+void TreeScope::AddElementById(const AtomicString& element_id, Element& element) {
+  elements_by_id_.Add(element_id, element);
+}
+
+void TreeScope::RemoveElementById(const AtomicString& element_id, Element& element) {
+  elements_by_id_.Remove(element_id, element);
+}
+
+const std::unordered_set<Element*>* TreeScope::ElementsWithClass(const AtomicString& class_name) const {
+  auto it = elements_by_class_.find(class_name);
+  return it != elements_by_class_.end() ? &it->second : nullptr;
+}
+
+void TreeScope::AddElementByClass(const AtomicString& class_name, Element& element) {
+  elements_by_class_[class_name].insert(&element);
+}
+
+void TreeScope::RemoveElementByClass(const AtomicString& class_name, Element& element) {
+  auto it = elements_by_class_.find(class_name);
+  if (it == elements_by_class_.end())
+    return;
+  it->second.erase(&element);
+  if (it->second.empty())
+    elements_by_class_.erase(it);
+}
+
 }  // namespace webf
@@ -7,11 +7,15 @@
 #define BRIDGE_CORE_DOM_TREE_SCOPE_H_
 
 #include <cassert>
+#include <unordered_map>
+#include <unordered_set>
+#include "tree_ordered_map.h"
 
 namespace webf {
 
 class ContainerNode;
 class Document;
+class Element;
 
 // The root node of a document tree (in which case this is a Document) or of a
 // shadow tree (in which case this is a ShadowRoot). Various things, like
@@ -29,6 +33,19 @@ class TreeScope {
     return *document_;
   }
 
+  ContainerNode& RootNode() const { return *root_node_; }
+
+  // Native id index, kept up to date by Element when it's connected or disconnected and when its id changes.
+  Element* getElementById(const AtomicString&) const;
+  void AddElementById(const AtomicString& element_id, Element&);
+  void RemoveElementById(const AtomicString& element_id, Element&);
+
+  // Native class index, the connected elements which have a class name, kept up to date in the same way as the id
+  // index. Returns nullptr when no element has it.
+  const std::unordered_set<Element*>* ElementsWithClass(const AtomicString& class_name) const;
+  void AddElementByClass(const AtomicString& class_name, Element&);
+  void RemoveElementByClass(const AtomicString& class_name, Element&);
+
  protected:
   explicit TreeScope(Document&);
 
@@ -36,6 +53,9 @@ class TreeScope {
   ContainerNode* root_node_;
   Document* document_;
   TreeScope* parent_tree_scope_;
+
+  TreeOrderedMap elements_by_id_;
+  std::unordered_map<AtomicString, std::unordered_set<Element*>, AtomicString::KeyHasher> elements_by_class_;
 };
 
 }  // namespace webf
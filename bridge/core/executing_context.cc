@@ -5,6 +5,7 @@
 #include "executing_context.h"
 
 #include <utility>
+#include "bindings/qjs/byte_code_cache.h"
 #include "bindings/qjs/converter_impl.h"
 #include "built_in_string.h"
 #include "core/dom/document.h"
@@ -45,9 +46,11 @@ ExecutingContext::ExecutingContext(DartContext* dart_context,
   //  #endif
 
   // @FIXME: maybe contextId will larger than MAX_JS_CONTEXT
-  valid_contexts[contextId] = true;
-  if (contextId > running_context_list)
-    running_context_list = contextId;
+  if (contextId != kUnboundContextId) {
+    valid_contexts[contextId] = true;
+    if (contextId > running_context_list)
+      running_context_list = contextId;
+  }
 
   time_origin_ = std::chrono::system_clock::now();
 
@@ -76,12 +79,9 @@ ExecutingContext::ExecutingContext(DartContext* dart_context,
 
   initWebFPolyFill(this);
 
-  for (auto& p : plugin_byte_code) {
-    EvaluateByteCode(p.second.bytes, p.second.length);
-  }
-
-  for (auto& p : plugin_string_code) {
-    EvaluateJavaScript(p.second.c_str(), p.second.size(), p.first.c_str(), 0);
+  // Plugins may call dart side, e.g. setTimeout(), pages built ahead of time by PagePool evaluate them once bound.
+  if (IsBoundToContextId()) {
+    EvaluatePlugins();
   }
 
   //#if ENABLE_PROFILE
@@ -91,7 +91,8 @@ ExecutingContext::ExecutingContext(DartContext* dart_context,
 
 ExecutingContext::~ExecutingContext() {
   is_context_valid_ = false;
-  valid_contexts[context_id_] = false;
+  if (IsBoundToContextId())
+    valid_contexts[context_id_] = false;
 
   // Check if current context have unhandled exceptions.
   JSValue exception = JS_GetException(script_state_.ctx());
@@ -101,12 +102,20 @@ ExecutingContext::~ExecutingContext() {
     assert_m(false, "Unhandled exception found when Dispose JSContext.");
   }
 
+  // Deferred wrappers are kept alive by the document, give them their JS object so that they are freed with it.
+  while (!deferred_wrappers_.empty()) {
+    (*deferred_wrappers_.begin())->EnsureQuickJSObject();
+  }
+
   JS_FreeValue(script_state_.ctx(), global_object_);
 
   // Free active wrappers.
   for (auto& active_wrapper : active_wrappers_) {
     JS_FreeValue(ctx(), active_wrapper->ToQuickJSUnsafe());
   }
+
+  // Free the constructors and prototypes created in this context.
+  context_data_.Dispose();
 }
 
 ExecutingContext* ExecutingContext::From(JSContext* ctx) {
@@ -118,31 +127,63 @@ bool ExecutingContext::EvaluateJavaScript(const uint16_t* code,
                                           const char* sourceURL,
                                           int startLine) {
   std::string utf8Code = toUTF8(std::u16string(reinterpret_cast<const char16_t*>(code), codeLength));
-  JSValue result = JS_Eval(script_state_.ctx(), utf8Code.c_str(), utf8Code.size(), sourceURL, JS_EVAL_TYPE_GLOBAL);
-  DrainPendingPromiseJobs();
-  bool success = HandleException(&result);
-  JS_FreeValue(script_state_.ctx(), result);
-  return success;
+  return EvaluateJavaScript(utf8Code.c_str(), utf8Code.size(), sourceURL, startLine);
 }
 
 bool ExecutingContext::EvaluateJavaScript(const char16_t* code, size_t length, const char* sourceURL, int startLine) {
   std::string utf8Code = toUTF8(std::u16string(reinterpret_cast<const char16_t*>(code), length));
-  JSValue result = JS_Eval(script_state_.ctx(), utf8Code.c_str(), utf8Code.size(), sourceURL, JS_EVAL_TYPE_GLOBAL);
-  DrainPendingPromiseJobs();
-  bool success = HandleException(&result);
-  JS_FreeValue(script_state_.ctx(), result);
-  return success;
+  return EvaluateJavaScript(utf8Code.c_str(), utf8Code.size(), sourceURL, startLine);
 }
 
 bool ExecutingContext::EvaluateJavaScript(const char* code, size_t codeLength, const char* sourceURL, int startLine) {
-  JSValue result = JS_Eval(script_state_.ctx(), code, codeLength, sourceURL, JS_EVAL_TYPE_GLOBAL);
+  JSValue result;
+  if (auto byte_code_cache = ByteCodeCache::ForScript(code, codeLength, sourceURL)) {
+    result = EvaluateWithByteCodeCache(*byte_code_cache, code, codeLength, sourceURL);
+  } else {
+    result = JS_Eval(script_state_.ctx(), code, codeLength, sourceURL, JS_EVAL_TYPE_GLOBAL);
+  }
   DrainPendingPromiseJobs();
   bool success = HandleException(&result);
   JS_FreeValue(script_state_.ctx(), result);
   return success;
 }
 
-bool ExecutingContext::EvaluateByteCode(uint8_t* bytes, size_t byteLength) {
+JSValue ExecutingContext::EvaluateWithByteCodeCache(const ByteCodeCache& byte_code_cache,
+                                                    const char* code,
+                                                    size_t codeLength,
+                                                    const char* sourceURL) {
+  JSContext* ctx = script_state_.ctx();
+  bool rejected = false;
+  if (auto cached = byte_code_cache.Load(&rejected)) {
+    JSValue function = JS_ReadObject(ctx, cached->bytes(), cached->length(), JS_READ_OBJ_BYTECODE);
+    if (!JS_IsException(function)) {
+      byte_code_cache_stats_.hits++;
+      return JS_EvalFunction(ctx, function);
+    }
+    // The checksum matched but the engine can't read it, compile the source instead.
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    rejected = true;
+  }
+
+  if (rejected)
+    byte_code_cache_stats_.rejects++;
+  byte_code_cache_stats_.misses++;
+
+  // Same as JS_Eval(), which compiles the source and evaluates the function, with the bytecode stored in between.
+  JSValue function = JS_Eval(ctx, code, codeLength, sourceURL, JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+  if (JS_IsException(function))
+    return function;
+  size_t length;
+  if (uint8_t* bytes = JS_WriteObject(ctx, &length, function, JS_WRITE_OBJ_BYTECODE)) {
+    byte_code_cache.Store(bytes, length);
+    js_free(ctx, bytes);
+  } else {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+  }
+  return JS_EvalFunction(ctx, function);
+}
+
+bool ExecutingContext::EvaluateByteCode(const uint8_t* bytes, size_t byteLength) {
   JSValue obj, val;
   obj = JS_ReadObject(script_state_.ctx(), bytes, byteLength, JS_READ_OBJ_BYTECODE);
   if (!HandleException(&obj))
@@ -154,6 +195,35 @@ bool ExecutingContext::EvaluateByteCode(uint8_t* bytes, size_t byteLength) {
   return true;
 }
 
+void ExecutingContext::EvaluatePlugins() {
+  for (auto& p : plugin_byte_code) {
+    EvaluateByteCode(p.second.bytes, p.second.length);
+  }
+
+  for (auto& p : plugin_string_code) {
+    EvaluatePluginCode(p.first, p.second);
+  }
+}
+
+void ExecutingContext::EvaluatePluginCode(const std::string& plugin_name, const std::string& code) {
+  auto& data = dart_context_->EnsureData();
+  if (const std::vector<uint8_t>* bytes = data->GetPluginByteCode(plugin_name, code)) {
+    EvaluateByteCode(bytes->data(), bytes->size());
+    DrainPendingPromiseJobs();
+    return;
+  }
+
+  size_t length;
+  uint8_t* bytes = DumpByteCode(code.c_str(), code.size(), plugin_name.c_str(), &length);
+  // The syntax error is reported, and the source is compiled again by the next page.
+  if (bytes == nullptr)
+    return;
+  data->SetPluginByteCode(plugin_name, code, std::vector<uint8_t>(bytes, bytes + length));
+  EvaluateByteCode(bytes, length);
+  js_free(script_state_.ctx(), bytes);
+  DrainPendingPromiseJobs();
+}
+
 bool ExecutingContext::IsContextValid() const {
   return is_context_valid_;
 }
@@ -251,6 +321,7 @@ void ExecutingContext::DrainPendingPromiseJobs() {
 
   // Throw error when promise are not handled.
   rejected_promises_.Process(this);
+  microtask_checkpoint_count_++;
 }
 
 void ExecutingContext::DefineGlobalProperty(const char* prop, JSValue value) {
@@ -304,12 +375,36 @@ static void DispatchPromiseRejectionEvent(const AtomicString& event_type,
   }
 }
 
+void ExecutingContext::BindContextId(int32_t context_id) {
+  assert(!IsBoundToContextId() && context_id != kUnboundContextId);
+  context_id_ = context_id;
+  // The page is navigated to now, not when the pool created it.
+  time_origin_ = std::chrono::system_clock::now();
+  valid_contexts[context_id] = true;
+  if (context_id > running_context_list)
+    running_context_list = context_id;
+  if (!ui_command_buffer_.empty()) {
+    ui_command_buffer_.ScheduleBatchUpdate();
+  }
+  EvaluatePlugins();
+}
+
 void ExecutingContext::FlushUICommand() {
-  if (!uiCommandBuffer()->empty()) {
+  // Commands of a pooled page stay in the buffer until dart side knows the page.
+  if (IsBoundToContextId() && !uiCommandBuffer()->empty()) {
     dartMethodPtr()->flushUICommand(context_id_);
   }
 }
 
+void ExecutingContext::UpdateViewportMetrics(const NativeViewportMetrics& metrics) {
+  viewport_metrics_ = metrics;
+  viewport_metrics_version_++;
+  // The size of the viewport changes layout.
+  if (document_ != nullptr) {
+    document_->InvalidateLayout();
+  }
+}
+
 void ExecutingContext::DispatchErrorEvent(ErrorEvent* error_event) {
   if (in_dispatch_error_event_) {
     return;
@@ -417,6 +512,14 @@ void ExecutingContext::RegisterActiveScriptWrappers(ScriptWrappable* script_wrap
   active_wrappers_.emplace_back(script_wrappable);
 }
 
+void ExecutingContext::RegisterDeferredWrapper(ScriptWrappable* script_wrappable) {
+  deferred_wrappers_.emplace(script_wrappable);
+}
+
+void ExecutingContext::UnregisterDeferredWrapper(ScriptWrappable* script_wrappable) {
+  deferred_wrappers_.erase(script_wrappable);
+}
+
 // An lock free context validator.
 bool isContextValid(int32_t contextId) {
   if (contextId > running_context_list)
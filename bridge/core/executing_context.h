@@ -15,7 +15,9 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include "bindings/qjs/binding_initializer.h"
+#include "bindings/qjs/byte_code_cache.h"
 #include "bindings/qjs/rejected_promises.h"
 #include "bindings/qjs/script_value.h"
 #include "foundation/macros.h"
@@ -27,6 +29,7 @@
 #include "frame/dom_timer_coordinator.h"
 #include "frame/module_context_coordinator.h"
 #include "frame/module_listener_container.h"
+#include "frame/viewport_metrics.h"
 #include "script_state.h"
 
 namespace webf {
@@ -54,6 +57,9 @@ bool isContextValid(int32_t contextId);
 // Window : Document : ExecutionContext = 1 : 1 : 1 at any point in time.
 class ExecutingContext {
  public:
+  // The context id of pages built ahead of time by PagePool, until they are handed out.
+  static constexpr int32_t kUnboundContextId = -1;
+
   ExecutingContext() = delete;
   ExecutingContext(DartContext* dart_context, int32_t contextId, JSExceptionHandler handler, void* owner);
   ~ExecutingContext();
@@ -63,12 +69,16 @@ class ExecutingContext {
   bool EvaluateJavaScript(const uint16_t* code, size_t codeLength, const char* sourceURL, int startLine);
   bool EvaluateJavaScript(const char16_t* code, size_t length, const char* sourceURL, int startLine);
   bool EvaluateJavaScript(const char* code, size_t codeLength, const char* sourceURL, int startLine);
-  bool EvaluateByteCode(uint8_t* bytes, size_t byteLength);
+  bool EvaluateByteCode(const uint8_t* bytes, size_t byteLength);
   bool IsContextValid() const;
   bool IsCtxValid() const;
   JSValue Global();
   JSContext* ctx();
   FORCE_INLINE int32_t contextId() const { return context_id_; };
+  FORCE_INLINE bool IsBoundToContextId() const { return context_id_ != kUnboundContextId; }
+  // Give a context built with kUnboundContextId its id. The UI commands emitted while building it are scheduled, and
+  // the plugins are evaluated.
+  void BindContextId(int32_t context_id);
   FORCE_INLINE int32_t uniqueId() const { return unique_id_; }
   void* owner();
   bool HandleException(JSValue* exc);
@@ -76,6 +86,9 @@ class ExecutingContext {
   bool HandleException(ExceptionState& exception_state);
   void ReportError(JSValueConst error);
   void DrainPendingPromiseJobs();
+  // Incremented each time the pending promise jobs are drained, at the end of every task and microtask checkpoint.
+  // Values cached for the duration of a task compare it to know when they are stale.
+  uint64_t MicrotaskCheckpointCount() const { return microtask_checkpoint_count_; }
   void DefineGlobalProperty(const char* prop, JSValueConst value);
   ExecutionContextData* contextData();
   uint8_t* DumpByteCode(const char* code, uint32_t codeLength, const char* sourceURL, size_t* bytecodeLength);
@@ -86,6 +99,13 @@ class ExecutingContext {
   // Register active script wrappers.
   void RegisterActiveScriptWrappers(ScriptWrappable* script_wrappable);
 
+  // Track the wrappers which have not created their JS object yet, see DeferredWrapperCreationScope.
+  bool DefersWrapperCreation() const { return defers_wrapper_creation_; }
+  void SetDefersWrapperCreation(bool defers) { defers_wrapper_creation_ = defers; }
+  void RegisterDeferredWrapper(ScriptWrappable* script_wrappable);
+  void UnregisterDeferredWrapper(ScriptWrappable* script_wrappable);
+  size_t DeferredWrapperCount() const { return deferred_wrappers_.size(); }
+
   // Gets the DOMTimerCoordinator which maintains the "active timer
   // list" of tasks created by setTimeout and setInterval. The
   // DOMTimerCoordinator is owned by the ExecutionContext and should
@@ -117,6 +137,23 @@ class ExecutingContext {
   // Force dart side to execute the pending ui commands.
   void FlushUICommand();
 
+  // The metrics last pushed from dart side, nullptr before the first push. Readers fall back to a synchronous call to
+  // dart side until then.
+  const NativeViewportMetrics* ViewportMetrics() const {
+    return viewport_metrics_version_ > 0 ? &viewport_metrics_ : nullptr;
+  }
+  // Increased by every push, caches derived from the metrics compare it to tell whether they are stale.
+  uint64_t ViewportMetricsVersion() const { return viewport_metrics_version_; }
+  void UpdateViewportMetrics(const NativeViewportMetrics& metrics);
+
+  // Attribute reads which were answered in native side instead of falling back to dart side, see
+  // ElementAttributes::getAttribute().
+  void RecordAvoidedAttributeFallback() { avoided_attribute_fallback_count_++; }
+  int64_t AvoidedAttributeFallbackCount() const { return avoided_attribute_fallback_count_; }
+
+  // Scripts long enough are evaluated through the ByteCodeCache once its directory is set.
+  const ByteCodeCacheStats& GetByteCodeCacheStats() const { return byte_code_cache_stats_; }
+
   void DispatchErrorEvent(ErrorEvent* error_event);
   void DispatchErrorEventInterval(ErrorEvent* error_event);
   void ReportErrorEvent(ErrorEvent* error_event);
@@ -138,6 +175,13 @@ class ExecutingContext {
 
   void InstallDocument();
   void InstallPerformance();
+  void EvaluatePlugins();
+  // Plugin sources are compiled once per DartContext, see DartContextData::GetPluginByteCode().
+  void EvaluatePluginCode(const std::string& plugin_name, const std::string& code);
+  JSValue EvaluateWithByteCodeCache(const ByteCodeCache& byte_code_cache,
+                                    const char* code,
+                                    size_t codeLength,
+                                    const char* sourceURL);
 
   static void promiseRejectTracker(JSContext* ctx,
                                    JSValueConst promise,
@@ -177,6 +221,13 @@ class ExecutingContext {
   RejectedPromises rejected_promises_;
   MemberMutationScope* active_mutation_scope{nullptr};
   std::vector<ScriptWrappable*> active_wrappers_;
+  std::unordered_set<ScriptWrappable*> deferred_wrappers_;
+  bool defers_wrapper_creation_{false};
+  NativeViewportMetrics viewport_metrics_{};
+  uint64_t viewport_metrics_version_{0};
+  int64_t avoided_attribute_fallback_count_{0};
+  uint64_t microtask_checkpoint_count_{0};
+  ByteCodeCacheStats byte_code_cache_stats_;
 };
 
 class ObjectProperty {
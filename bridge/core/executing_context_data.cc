@@ -39,7 +39,8 @@ JSValue ExecutionContextData::constructorForIdSlowCase(const WrapperTypeInfo* ty
   def.call = type->callFunc;
   JS_NewClass(m_context->dartContext()->runtime(), class_id, &def);
 
-  // Create class object and prototype object.
+  // Create class object and prototype object. The maps own a reference to them, the constructor is only exposed to
+  // scripts when they read it from the global object.
   JSValue classObject = constructor_map_[type] = JS_NewObjectClass(m_context->ctx(), class_id);
   JSValue prototypeObject = prototype_map_[type] = JS_NewObject(m_context->ctx());
 
@@ -52,13 +53,12 @@ JSValue ExecutionContextData::constructorForIdSlowCase(const WrapperTypeInfo* ty
 
   // Bind class object and prototype object.
   JSAtom prototypeKey = JS_NewAtom(ctx, "prototype");
-  JS_DefinePropertyValue(ctx, classObject, prototypeKey, prototypeObject, JS_PROP_C_W_E);
+  JS_DefinePropertyValue(ctx, classObject, prototypeKey, JS_DupValue(ctx, prototypeObject), JS_PROP_C_W_E);
   JS_FreeAtom(ctx, prototypeKey);
 
-  // Inherit to parentClass.
+  // Inherit to parentClass, which is created first when no object of it was created yet.
   if (type->parent_class != nullptr) {
-    assert(prototype_map_.count(type->parent_class) > 0);
-    JS_SetPrototype(m_context->ctx(), prototypeObject, prototype_map_[type->parent_class]);
+    JS_SetPrototype(m_context->ctx(), prototypeObject, prototypeForType(type->parent_class));
   }
 
   // Configure to be called as a constructor.
@@ -67,9 +67,18 @@ JSValue ExecutionContextData::constructorForIdSlowCase(const WrapperTypeInfo* ty
   // Store WrapperTypeInfo as private data.
   JS_SetOpaque(classObject, (void*)type);
 
+  // Define the methods and attributes now that the prototype is reachable through prototypeForType().
+  if (type->install_prototype_handler_ != nullptr) {
+    type->install_prototype_handler_(m_context);
+  }
+
   return classObject;
 }
 
+bool ExecutionContextData::hasConstructorForType(const WrapperTypeInfo* type) const {
+  return constructor_map_.count(type) > 0;
+}
+
 void ExecutionContextData::Dispose() {
   for (auto& entry : prototype_map_) {
     JS_FreeValueRT(m_context->dartContext()->runtime(), entry.second);
@@ -78,6 +87,9 @@ void ExecutionContextData::Dispose() {
   for (auto& entry : constructor_map_) {
     JS_FreeValueRT(m_context->dartContext()->runtime(), entry.second);
   }
+
+  prototype_map_.clear();
+  constructor_map_.clear();
 }
 
 }  // namespace webf
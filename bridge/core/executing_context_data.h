@@ -25,6 +25,9 @@ class ExecutionContextData final {
   JSValue constructorForType(const WrapperTypeInfo* type);
   // Returns the prototype object that is appropriately initialized.
   JSValue prototypeForType(const WrapperTypeInfo* type);
+  // Whether the constructor and the prototype of |type| were created. They are created on first use: when scripts
+  // read the constructor from the global object, or when the first object of the type is created.
+  bool hasConstructorForType(const WrapperTypeInfo* type) const;
 
   void Dispose();
 
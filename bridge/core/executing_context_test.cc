@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 #include "include/webf_bridge.h"
 #include "page.h"
+#include "qjs_gesture_event.h"
 #include "webf_test_env.h"
 
 using namespace webf;
@@ -342,6 +343,86 @@ TEST(Context, evaluateByteCode) {
   EXPECT_EQ(logCalled, true);
 }
 
+TEST(Context, evaluateUTF8ScriptsInPlace) {
+  static bool errorHandlerExecuted = false;
+  static bool logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "你好 3");
+  };
+
+  auto errorHandler = [](int32_t contextId, const char* errmsg) { errorHandlerExecuted = true; };
+  auto bridge = TEST_init(errorHandler);
+  std::string code = "let text = '你好'; console.log(text, text.length + 1);";
+  evaluateUTF8Scripts(bridge.get(), code.c_str(), code.size(), code.size() + 1, "vm://", 0);
+
+  EXPECT_EQ(errorHandlerExecuted, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Context, evaluateUTF8ScriptsWithoutTerminator) {
+  static bool errorHandlerExecuted = false;
+  static bool logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "3");
+  };
+
+  auto errorHandler = [](int32_t contextId, const char* errmsg) { errorHandlerExecuted = true; };
+  auto bridge = TEST_init(errorHandler);
+  // The byte after the source is not part of the script, compiling it would throw a SyntaxError.
+  std::string code = "console.log(1 + 2)(";
+  evaluateUTF8Scripts(bridge.get(), code.c_str(), code.size() - 1, code.size() - 1, "vm://", 0);
+  evaluateUTF8Scripts(bridge.get(), code.c_str(), code.size() - 1, code.size(), "vm://", 0);
+
+  EXPECT_EQ(errorHandlerExecuted, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Context, pluginCodeIsCompiledOncePerDartContext) {
+  static int logCount = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCount++;
+    EXPECT_STREQ(message.c_str(), "plugin loaded");
+  };
+  std::string code = "console.log('plugin loaded');";
+  registerPluginCode(code.c_str(), code.size(), "test_plugin");
+
+  auto first = TEST_init();
+  auto& data = first->GetExecutingContext()->dartContext()->EnsureData();
+  const std::vector<uint8_t>* bytes = data->GetPluginByteCode("test_plugin", code);
+  ASSERT_NE(bytes, nullptr);
+
+  // The second page reads the bytecode compiled by the first one.
+  auto second = TEST_init();
+  EXPECT_EQ(data->GetPluginByteCode("test_plugin", code), bytes);
+  EXPECT_EQ(logCount, 2);
+
+  ExecutingContext::plugin_string_code.erase("test_plugin");
+  webf::WebFPage::consoleMessageHandler = nullptr;
+}
+
+TEST(Context, bindingsAreInstalledOnFirstUse) {
+  static int logCount = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCount++;
+    EXPECT_STREQ(message.c_str(), "function true true number true");
+  };
+  auto bridge = TEST_init();
+  ExecutionContextData* context_data = bridge->GetExecutingContext()->contextData();
+  EXPECT_FALSE(context_data->hasConstructorForType(QJSGestureEvent::GetWrapperTypeInfo()));
+
+  const char* code =
+      "var event = new GestureEvent('swipe', { deltaX: 10 });"
+      "console.log([typeof GestureEvent, event instanceof Event, 'deltaX' in GestureEvent.prototype,"
+      "  typeof event.deltaX, Object.getOwnPropertyDescriptor(globalThis, 'GestureEvent').value === GestureEvent"
+      "].join(' '));";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_TRUE(context_data->hasConstructorForType(QJSGestureEvent::GetWrapperTypeInfo()));
+  EXPECT_EQ(logCount, 1);
+  webf::WebFPage::consoleMessageHandler = nullptr;
+}
+
 TEST(jsValueToNativeString, utf8String) {
   auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {});
   JSValue str = JS_NewString(bridge->GetExecutingContext()->ctx(), "helloworld");
@@ -14,6 +14,12 @@ void Location::__webf_location_reload__(ExecutingContext* context, ExceptionStat
     return;
   }
 
+  if (!context->IsBoundToContextId()) {
+    exception_state.ThrowException(context->ctx(), ErrorType::InternalError,
+                                   "Failed to execute 'reload': the page is not bound to a context id yet.");
+    return;
+  }
+
   context->FlushUICommand();
   context->dartMethodPtr()->reloadApp(context->contextId());
 }
@@ -113,6 +113,12 @@ ScriptValue ModuleManager::__webf_invoke_module__(ExecutingContext* context,
     return ScriptValue::Empty(context->ctx());
   }
 
+  if (!context->IsBoundToContextId()) {
+    exception.ThrowException(context->ctx(), ErrorType::InternalError,
+                             "Failed to execute '__webf_invoke_module__': the page is not bound to a context id yet.");
+    return ScriptValue::Empty(context->ctx());
+  }
+
   NativeValue* result;
   if (callback != nullptr) {
     auto module_callback = ModuleCallback::Create(callback);
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+#include "property_batch_reader.h"
+#include "bindings/qjs/converter_impl.h"
+#include "core/dom/events/event_target.h"
+#include "core/executing_context.h"
+#include "qjs_event_target.h"
+
+namespace webf {
+
+std::vector<ScriptValue> PropertyBatchReader::__webf_batch_read__(ExecutingContext* context,
+                                                                  const ScriptValue& targets,
+                                                                  const std::vector<AtomicString>& properties,
+                                                                  ExceptionState& exception_state) {
+  JSContext* ctx = context->ctx();
+  std::vector<ScriptValue> target_values =
+      Converter<IDLSequence<IDLAny>>::FromValue(ctx, targets.QJSValue(), exception_state);
+  if (exception_state.HasException())
+    return {};
+
+  if (target_values.size() != properties.size()) {
+    exception_state.ThrowException(ctx, ErrorType::TypeError,
+                                   "Failed to execute 'batchRead': targets and properties must have the same length.");
+    return {};
+  }
+
+  std::vector<EventTarget*> event_targets;
+  event_targets.reserve(target_values.size());
+  for (auto& value : target_values) {
+    EventTarget* target = QJSEventTarget::ToWrappable(context, value.QJSValue());
+    if (target == nullptr) {
+      exception_state.ThrowException(ctx, ErrorType::TypeError,
+                                     "Failed to execute 'batchRead': targets must be event targets.");
+      return {};
+    }
+    event_targets.emplace_back(target);
+  }
+
+  std::vector<BindingPropertyQuery> queries;
+  queries.reserve(properties.size());
+  for (size_t i = 0; i < properties.size(); i++) {
+    queries.emplace_back(
+        BindingPropertyQuery{event_targets[i], Native_NewString(properties[i].ToNativeString(ctx).release())});
+  }
+
+  if (queries.empty())
+    return {};
+
+  std::vector<NativeValue> results(queries.size());
+  queries[0].target->GetBindingProperties(queries, results.data(), exception_state);
+  if (exception_state.HasException())
+    return {};
+
+  std::vector<ScriptValue> values;
+  values.reserve(results.size());
+  for (auto& result : results) {
+    values.emplace_back(ctx, result);
+  }
+  return values;
+}
+
+}  // namespace webf
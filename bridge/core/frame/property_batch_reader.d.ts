@@ -0,0 +1 @@
+declare const __webf_batch_read__: (targets: any, properties: string[]) => any[];
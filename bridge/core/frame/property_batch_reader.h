@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+#ifndef BRIDGE_CORE_FRAME_PROPERTY_BATCH_READER_H_
+#define BRIDGE_CORE_FRAME_PROPERTY_BATCH_READER_H_
+
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/exception_state.h"
+#include "bindings/qjs/script_value.h"
+
+namespace webf {
+
+class ExecutingContext;
+
+// Backs webf.batchRead(targets, properties): reads properties[i] of targets[i] for all of the event targets with a
+// single call to dart side, instead of one synchronous call per property.
+class PropertyBatchReader {
+ public:
+  static std::vector<ScriptValue> __webf_batch_read__(ExecutingContext* context,
+                                                      const ScriptValue& targets,
+                                                      const std::vector<AtomicString>& properties,
+                                                      ExceptionState& exception_state);
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_FRAME_PROPERTY_BATCH_READER_H_
@@ -4,6 +4,8 @@
  */
 
 #include "screen.h"
+#include "binding_call_method_ids.h"
+#include "core/executing_context.h"
 #include "core/frame/window.h"
 #include "foundation/native_value_converter.h"
 
@@ -12,4 +14,38 @@ namespace webf {
 Screen::Screen(Window* window, NativeBindingObject* native_binding_object)
     : EventTargetWithInlineData(window->GetExecutingContext(), native_binding_object) {}
 
+int64_t Screen::availWidth() {
+  if (const NativeViewportMetrics* metrics = GetExecutingContext()->ViewportMetrics())
+    return metrics->screen_avail_width;
+  return GetMetricFromDart(BindingMethodId::kavailWidth);
+}
+
+int64_t Screen::availHeight() {
+  if (const NativeViewportMetrics* metrics = GetExecutingContext()->ViewportMetrics())
+    return metrics->screen_avail_height;
+  return GetMetricFromDart(BindingMethodId::kavailHeight);
+}
+
+int64_t Screen::width() {
+  if (const NativeViewportMetrics* metrics = GetExecutingContext()->ViewportMetrics())
+    return metrics->screen_width;
+  return GetMetricFromDart(BindingMethodId::kwidth);
+}
+
+int64_t Screen::height() {
+  if (const NativeViewportMetrics* metrics = GetExecutingContext()->ViewportMetrics())
+    return metrics->screen_height;
+  return GetMetricFromDart(BindingMethodId::kheight);
+}
+
+int64_t Screen::GetMetricFromDart(BindingMethodId prop) {
+  ExceptionState exception_state;
+  NativeValue value = GetBindingProperty(prop, exception_state);
+  if (exception_state.HasException()) {
+    GetExecutingContext()->HandleException(exception_state);
+    return 0;
+  }
+  return NativeValueConverter<NativeTypeInt64>::FromNativeValue(value);
+}
+
 }  // namespace webf
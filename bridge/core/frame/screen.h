@@ -20,7 +20,15 @@ class Screen : public EventTargetWithInlineData {
   using ImplType = Screen*;
   explicit Screen(Window* window, NativeBindingObject* binding_object);
 
+  // Served from the viewport metrics pushed by dart side.
+  int64_t availWidth();
+  int64_t availHeight();
+  int64_t width();
+  int64_t height();
+
  private:
+  // Only used before dart side pushed the first viewport metrics.
+  int64_t GetMetricFromDart(BindingMethodId prop);
 };
 
 }  // namespace webf
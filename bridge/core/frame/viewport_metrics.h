@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+#ifndef BRIDGE_CORE_FRAME_VIEWPORT_METRICS_H_
+#define BRIDGE_CORE_FRAME_VIEWPORT_METRICS_H_
+
+#include <cinttypes>
+
+namespace webf {
+
+// Window and screen metrics, which only change on resize or rotation. Dart side pushes a new snapshot whenever they
+// change, see updateViewportMetrics in webf_bridge.h.
+struct NativeViewportMetrics {
+  double device_pixel_ratio;
+  double inner_width;
+  double inner_height;
+  int64_t screen_width;
+  int64_t screen_height;
+  int64_t screen_avail_width;
+  int64_t screen_avail_height;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_FRAME_VIEWPORT_METRICS_H_
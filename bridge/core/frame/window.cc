@@ -4,7 +4,7 @@
  */
 
 #include "window.h"
-#include "binding_call_methods.h"
+#include "binding_call_method_ids.h"
 #include "bindings/qjs/cppgc/garbage_collected.h"
 #include "core/dom/document.h"
 #include "core/events/message_event.h"
@@ -26,19 +26,47 @@ Window* Window::open(const AtomicString& url, ExceptionState& exception_state) {
   const NativeValue args[] = {
       NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), url),
   };
-  InvokeBindingMethod(binding_call_methods::kopen, 1, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kopen, 1, args, exception_state);
   return this;
 }
 
 Screen* Window::screen() {
   if (screen_ == nullptr) {
-    NativeValue value = GetBindingProperty(binding_call_methods::kscreen, ASSERT_NO_EXCEPTION());
+    NativeValue value = GetBindingProperty(BindingMethodId::kscreen, ASSERT_NO_EXCEPTION());
     screen_ = MakeGarbageCollected<Screen>(
         this, NativeValueConverter<NativeTypePointer<NativeBindingObject>>::FromNativeValue(value));
   }
   return screen_;
 }
 
+double Window::devicePixelRatio() {
+  if (const NativeViewportMetrics* metrics = GetExecutingContext()->ViewportMetrics())
+    return metrics->device_pixel_ratio;
+  return GetViewportMetricFromDart(BindingMethodId::kdevicePixelRatio);
+}
+
+double Window::innerWidth() {
+  if (const NativeViewportMetrics* metrics = GetExecutingContext()->ViewportMetrics())
+    return metrics->inner_width;
+  return GetViewportMetricFromDart(BindingMethodId::kinnerWidth);
+}
+
+double Window::innerHeight() {
+  if (const NativeViewportMetrics* metrics = GetExecutingContext()->ViewportMetrics())
+    return metrics->inner_height;
+  return GetViewportMetricFromDart(BindingMethodId::kinnerHeight);
+}
+
+double Window::GetViewportMetricFromDart(BindingMethodId prop) {
+  ExceptionState exception_state;
+  NativeValue value = GetBindingProperty(prop, exception_state);
+  if (exception_state.HasException()) {
+    GetExecutingContext()->HandleException(exception_state);
+    return 0;
+  }
+  return NativeValueConverter<NativeTypeDouble>::FromNativeValue(value);
+}
+
 void Window::scroll(ExceptionState& exception_state) {
   return scroll(0, 0, exception_state);
 }
@@ -48,7 +76,7 @@ void Window::scroll(double x, double y, ExceptionState& exception_state) {
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(x),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(y),
   };
-  InvokeBindingMethod(binding_call_methods::kscroll, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscroll, 2, args, exception_state);
 }
 
 void Window::scroll(const std::shared_ptr<ScrollToOptions>& options, ExceptionState& exception_state) {
@@ -56,7 +84,7 @@ void Window::scroll(const std::shared_ptr<ScrollToOptions>& options, ExceptionSt
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasLeft() ? options->left() : 0.0),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasTop() ? options->top() : 0.0),
   };
-  InvokeBindingMethod(binding_call_methods::kscroll, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscroll, 2, args, exception_state);
 }
 
 void Window::scrollBy(ExceptionState& exception_state) {
@@ -68,7 +96,7 @@ void Window::scrollBy(double x, double y, ExceptionState& exception_state) {
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(x),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(y),
   };
-  InvokeBindingMethod(binding_call_methods::kscrollBy, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscrollBy, 2, args, exception_state);
 }
 
 void Window::scrollBy(const std::shared_ptr<ScrollToOptions>& options, ExceptionState& exception_state) {
@@ -76,7 +104,7 @@ void Window::scrollBy(const std::shared_ptr<ScrollToOptions>& options, Exception
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasLeft() ? options->left() : 0.0),
       NativeValueConverter<NativeTypeDouble>::ToNativeValue(options->hasTop() ? options->top() : 0.0),
   };
-  InvokeBindingMethod(binding_call_methods::kscrollBy, 2, args, exception_state);
+  InvokeBindingMethod(BindingMethodId::kscrollBy, 2, args, exception_state);
 }
 
 void Window::scrollTo(ExceptionState& exception_state) {
@@ -27,10 +27,10 @@ interface Window extends EventTarget, WindowEventHandlers, GlobalEventHandlers {
 
   readonly scrollX: DartImpl<double>;
   readonly scrollY: DartImpl<double>;
-  readonly devicePixelRatio: DartImpl<double>;
+  readonly devicePixelRatio: double;
   readonly colorScheme: DartImpl<string>;
-  readonly innerWidth: DartImpl<double>;
-  readonly innerHeight: DartImpl<double>;
+  readonly innerWidth: double;
+  readonly innerHeight: double;
 
   new(): void;
 }
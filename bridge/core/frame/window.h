@@ -25,6 +25,11 @@ class Window : public EventTargetWithInlineData {
 
   Screen* screen();
 
+  // Served from the viewport metrics pushed by dart side.
+  double devicePixelRatio();
+  double innerWidth();
+  double innerHeight();
+
   [[nodiscard]] const Window* window() const { return this; }
   [[nodiscard]] const Window* self() const { return this; }
   [[nodiscard]] const Window* parent() const { return this; }
@@ -53,6 +58,9 @@ class Window : public EventTargetWithInlineData {
   JSValue ToQuickJS() const override;
 
  private:
+  // Only used before dart side pushed the first viewport metrics.
+  double GetViewportMetricFromDart(BindingMethodId prop);
+
   Member<Screen> screen_;
 };
 
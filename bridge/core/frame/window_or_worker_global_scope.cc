@@ -74,6 +74,12 @@ int WindowOrWorkerGlobalScope::setTimeout(ExecutingContext* context,
   }
 #endif
 
+  if (!context->IsBoundToContextId()) {
+    exception.ThrowException(context->ctx(), ErrorType::InternalError,
+                             "Failed to execute 'setTimeout': the page is not bound to a context id yet.");
+    return -1;
+  }
+
   // Create a timer object to keep track timer callback.
   auto timer = DOMTimer::create(context, handler, DOMTimer::TimerKind::kOnce);
   auto timerId =
@@ -103,6 +109,12 @@ int WindowOrWorkerGlobalScope::setInterval(ExecutingContext* context,
     return -1;
   }
 
+  if (!context->IsBoundToContextId()) {
+    exception.ThrowException(context->ctx(), ErrorType::InternalError,
+                             "Failed to execute 'setInterval': the page is not bound to a context id yet.");
+    return -1;
+  }
+
   // Create a timer object to keep track timer callback.
   auto timer = DOMTimer::create(context, handler, DOMTimer::TimerKind::kMultiple);
 
@@ -117,6 +129,10 @@ int WindowOrWorkerGlobalScope::setInterval(ExecutingContext* context,
 }
 
 void WindowOrWorkerGlobalScope::clearTimeout(ExecutingContext* context, int32_t timerId, ExceptionState& exception) {
+  // Timers can't be installed before the page is bound, there is nothing to clear.
+  if (!context->IsBoundToContextId())
+    return;
+
   if (context->dartMethodPtr()->clearTimeout == nullptr) {
     exception.ThrowException(context->ctx(), ErrorType::InternalError,
                              "Failed to execute 'clearTimeout': dart method (clearTimeout) is not registered.");
@@ -128,6 +144,10 @@ void WindowOrWorkerGlobalScope::clearTimeout(ExecutingContext* context, int32_t
 }
 
 void WindowOrWorkerGlobalScope::clearInterval(ExecutingContext* context, int32_t timerId, ExceptionState& exception) {
+  // Timers can't be installed before the page is bound, there is nothing to clear.
+  if (!context->IsBoundToContextId())
+    return;
+
   if (context->dartMethodPtr()->clearTimeout == nullptr) {
     exception.ThrowException(context->ctx(), ErrorType::InternalError,
                              "Failed to execute 'clearTimeout': dart method (clearTimeout) is not registered.");
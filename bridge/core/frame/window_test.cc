@@ -4,6 +4,7 @@
  */
 
 #include "window.h"
+#include "core/dom/document.h"
 #include "gtest/gtest.h"
 #include "webf_test_env.h"
 
@@ -137,3 +138,34 @@ TEST(Window, onloadShouldExist) {
   bridge->evaluateScript(code.c_str(), code.size(), "vm://", 0);
   EXPECT_EQ(errorCalled, false);
 }
+
+TEST(Window, viewportMetricsAreReadFromPushedSnapshot) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  static int dartCalls = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "2 360 640");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = bridge->GetExecutingContext();
+  context->window()->bindingObject()->invoke_bindings_methods_from_native =
+      [](const NativeBindingObject* binding_object, NativeValue* return_value, NativeValue* method, int32_t argc,
+         const NativeValue* argv) { dartCalls++; };
+
+  uint64_t layout_version = context->document()->LayoutVersion();
+  context->UpdateViewportMetrics(NativeViewportMetrics{2, 360, 640, 360, 640, 360, 600});
+  EXPECT_EQ(context->ViewportMetricsVersion(), 1);
+  EXPECT_NE(context->document()->LayoutVersion(), layout_version);
+
+  const char* code = "console.log(window.devicePixelRatio, window.innerWidth, window.innerHeight)";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  context->window()->bindingObject()->invoke_bindings_methods_from_native = nullptr;
+
+  EXPECT_EQ(dartCalls, 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
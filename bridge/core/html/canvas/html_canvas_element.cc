@@ -3,7 +3,7 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 #include "html_canvas_element.h"
-#include "binding_call_methods.h"
+#include "binding_call_method_ids.h"
 #include "canvas_rendering_context_2d.h"
 #include "canvas_types.h"
 #include "foundation/native_value_converter.h"
@@ -16,7 +16,7 @@ HTMLCanvasElement::HTMLCanvasElement(Document& document) : HTMLElement(html_name
 
 CanvasRenderingContext* HTMLCanvasElement::getContext(const AtomicString& type, ExceptionState& exception_state) const {
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), type)};
-  NativeValue value = InvokeBindingMethod(binding_call_methods::kgetContext, 1, arguments, exception_state);
+  NativeValue value = InvokeBindingMethod(BindingMethodId::kgetContext, 1, arguments, exception_state);
   NativeBindingObject* native_binding_object =
       NativeValueConverter<NativeTypePointer<NativeBindingObject>>::FromNativeValue(value);
 
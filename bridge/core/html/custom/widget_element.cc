@@ -4,7 +4,7 @@
  */
 
 #include "widget_element.h"
-#include "binding_call_methods.h"
+#include "binding_call_method_ids.h"
 #include "built_in_string.h"
 #include "core/dom/document.h"
 #include "foundation/native_value_converter.h"
@@ -40,15 +40,52 @@ void WidgetElement::NamedPropertyEnumerator(std::vector<AtomicString>& names, Ex
   for (auto& property_name : property_names) {
     names.emplace_back(property_name);
   }
+
+  // Only the names are needed here, the values are read in one batch if the caller goes on reading them.
+  prefetched_properties_.clear();
+  bulk_read_names_.clear();
+  auto shape = GetExecutingContext()->dartContext()->EnsureData()->GetWidgetElementShape(tag_name_);
+  if (shape == nullptr)
+    return;
+  for (auto& name : names) {
+    if (shape->built_in_properties_.count(name) > 0)
+      bulk_read_names_.emplace_back(name);
+  }
+  prefetched_checkpoint_ = GetExecutingContext()->MicrotaskCheckpointCount();
+  prefetched_layout_version_ = GetDocument().LayoutVersion();
+}
+
+bool WidgetElement::IsPrefetchFresh() const {
+  return prefetched_checkpoint_ == GetExecutingContext()->MicrotaskCheckpointCount() &&
+         prefetched_layout_version_ == GetDocument().LayoutVersion();
+}
+
+void WidgetElement::PrefetchBuiltInProperties(ExceptionState& exception_state) {
+  std::vector<AtomicString> keys;
+  keys.swap(bulk_read_names_);
+  std::vector<BindingPropertyQuery> queries;
+  queries.reserve(keys.size());
+  for (auto& name : keys) {
+    queries.emplace_back(BindingPropertyQuery{this, Native_NewString(name.ToNativeString(ctx()).release())});
+  }
+
+  std::vector<NativeValue> results(queries.size());
+  GetBindingProperties(queries, results.data(), exception_state);
+  if (exception_state.HasException())
+    return;
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    prefetched_properties_[keys[i]] = ScriptValue(ctx(), results[i]);
+  }
 }
 
 NativeValue WidgetElement::HandleCallFromDartSide(const NativeValue* native_method,
                                                   int32_t argc,
                                                   const NativeValue* argv) {
   MemberMutationScope mutation_scope{GetExecutingContext()};
-  AtomicString method = NativeValueConverter<NativeTypeString>::FromNativeValue(ctx(), *native_method);
+  auto method = static_cast<BindingMethodId>(NativeValueConverter<NativeTypeInt64>::FromNativeValue(*native_method));
 
-  if (method == binding_call_methods::ksyncPropertiesAndMethods) {
+  if (method == BindingMethodId::ksyncPropertiesAndMethods) {
     return HandleSyncPropertiesAndMethodsFromDart(argc, argv);
   }
 
@@ -71,6 +108,22 @@ ScriptValue WidgetElement::item(const AtomicString& key, ExceptionState& excepti
   auto shape = GetExecutingContext()->dartContext()->EnsureData()->GetWidgetElementShape(tag_name_);
   if (shape != nullptr) {
     if (shape->built_in_properties_.count(key) > 0) {
+      if (!IsPrefetchFresh()) {
+        prefetched_properties_.clear();
+        bulk_read_names_.clear();
+      }
+      // The first read after an enumeration reads all the enumerated built-in properties.
+      if (!bulk_read_names_.empty()) {
+        PrefetchBuiltInProperties(exception_state);
+        if (exception_state.HasException())
+          return ScriptValue::Empty(ctx());
+      }
+      auto prefetched = prefetched_properties_.find(key);
+      if (prefetched != prefetched_properties_.end()) {
+        ScriptValue value = prefetched->second;
+        prefetched_properties_.erase(prefetched);
+        return value;
+      }
       return ScriptValue(ctx(), GetBindingProperty(key, exception_state));
     }
 
@@ -99,6 +152,7 @@ ScriptValue WidgetElement::item(const AtomicString& key, ExceptionState& excepti
 }
 
 bool WidgetElement::SetItem(const AtomicString& key, const ScriptValue& value, ExceptionState& exception_state) {
+  prefetched_properties_.clear();
   if (!GetExecutingContext()->dartContext()->EnsureData()->HasWidgetElementShape(tag_name_)) {
     GetExecutingContext()->FlushUICommand();
   }
@@ -130,6 +184,10 @@ void WidgetElement::Trace(GCVisitor* visitor) const {
   for (auto& entry : async_cached_methods_) {
     entry.second.Trace(visitor);
   }
+
+  for (auto& entry : prefetched_properties_) {
+    entry.second.Trace(visitor);
+  }
 }
 
 void WidgetElement::CloneNonAttributePropertiesFrom(const Element& other, CloneChildrenFlag flag) {
@@ -7,6 +7,7 @@
 
 #include <set>
 #include <unordered_map>
+#include <vector>
 #include "core/html/html_element.h"
 
 namespace webf {
@@ -43,9 +44,19 @@ class WidgetElement : public HTMLElement {
   ScriptValue CreateSyncMethodFunc(const AtomicString& method_name);
   ScriptValue CreateAsyncMethodFunc(const AtomicString& method_name);
   NativeValue HandleSyncPropertiesAndMethodsFromDart(int32_t argc, const NativeValue* argv);
+  // Enumerating properties is usually followed by reading all of them, e.g. {...widget}. The first read after an
+  // enumeration reads the enumerated built-in properties in a single batch. Each prefetched value serves one item()
+  // call within the same task or microtask, while the layout version is unchanged.
+  void PrefetchBuiltInProperties(ExceptionState& exception_state);
+  bool IsPrefetchFresh() const;
   std::unordered_map<AtomicString, ScriptValue, AtomicString::KeyHasher> cached_methods_;
   std::unordered_map<AtomicString, ScriptValue, AtomicString::KeyHasher> async_cached_methods_;
   std::unordered_map<AtomicString, ScriptValue, AtomicString::KeyHasher> unimplemented_properties_;
+  std::unordered_map<AtomicString, ScriptValue, AtomicString::KeyHasher> prefetched_properties_;
+  // Built-in properties enumerated but not read yet.
+  std::vector<AtomicString> bulk_read_names_;
+  uint64_t prefetched_layout_version_{0};
+  uint64_t prefetched_checkpoint_{0};
 };
 
 template <>
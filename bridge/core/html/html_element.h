@@ -18,6 +18,11 @@ class HTMLElement : public Element {
   using ImplType = HTMLElement*;
   HTMLElement(const AtomicString& tag_name, Document* document, ConstructionType);
 
+  double offsetTop() { return GetGeometry(ElementGeometryField::kOffsetTop); }
+  double offsetLeft() { return GetGeometry(ElementGeometryField::kOffsetLeft); }
+  double offsetWidth() { return GetGeometry(ElementGeometryField::kOffsetWidth); }
+  double offsetHeight() { return GetGeometry(ElementGeometryField::kOffsetHeight); }
+
   bool IsAttributeDefinedInternal(const AtomicString& key) const override;
 
  private:
@@ -4,54 +4,97 @@
  */
 
 #include "html_collection.h"
+#include <algorithm>
 #include "bindings/qjs/cppgc/gc_visitor.h"
 #include "core/dom/container_node.h"
 
 namespace webf {
 
-HTMLCollection::HTMLCollection(ContainerNode* base, CollectionType type)
-    : base_(base), type_(type), ScriptWrappable(base->ctx()) {}
+static NodeListSearchRoot SearchRootFromCollectionType(CollectionType type) {
+  switch (type) {
+    case kDocImages:
+    case kDocApplets:
+    case kDocEmbeds:
+    case kDocForms:
+    case kDocLinks:
+    case kDocAnchors:
+    case kDocScripts:
+    case kDocAll:
+    case kWindowNamedItems:
+    case kDocumentNamedItems:
+    case kDocumentAllNamedItems:
+      return NodeListSearchRoot::kTreeScope;
+    default:
+      return NodeListSearchRoot::kOwnerNode;
+  }
+}
 
-unsigned int HTMLCollection::length() const {
-  int32_t length = 0;
+HTMLCollection::HTMLCollection(ContainerNode& base, CollectionType type, NodeListInvalidationType invalidation_type)
+    : ScriptWrappable(base.ctx()),
+      LiveNodeListBase(&base, SearchRootFromCollectionType(type), invalidation_type, type) {}
 
-  if (type_ == CollectionType::kDocAll) {
-    auto* document = DynamicTo<Document>(*base_);
-    for (const Node& child : NodeTraversal::InclusiveDescendantsOf(*document->documentElement())) {
-      length++;
-    }
-  }
+HTMLCollection::HTMLCollection(ContainerNode& base, CollectionType type)
+    : HTMLCollection(base, type, kDoNotInvalidateOnAttributeChanges) {}
 
-  return length;
+unsigned HTMLCollection::length() const {
+  InvalidateCacheIfNeeded();
+  return collection_items_cache_.NodeCount(*this);
 }
 
-Element* HTMLCollection::item(unsigned int offset, ExceptionState& exception_state) const {
-  if (type_ == CollectionType::kDocAll) {
-    int32_t i = 0;
-    auto* document = DynamicTo<Document>(*base_);
-    for (Node& child : ElementTraversal ::InclusiveDescendantsOf(*document->documentElement())) {
-      if (i == offset) {
-        return DynamicTo<Element>(child);
-      }
-      i++;
-    }
-  }
-
-  return nullptr;
+Element* HTMLCollection::item(unsigned offset, ExceptionState& exception_state) const {
+  InvalidateCacheIfNeeded();
+  return collection_items_cache_.NodeAt(*this, offset);
 }
 
 bool HTMLCollection::NamedPropertyQuery(const AtomicString& key, ExceptionState&) {
-  int32_t index = std::stoi(key.ToStdString(ctx()));
-  return index >= 0 && index < nodes_.size();
+  std::string string = key.ToStdString(ctx());
+  if (string.empty() || string.length() > 9 ||
+      !std::all_of(string.begin(), string.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    return false;
+  return std::stoul(string) < length();
 }
 
 void HTMLCollection::NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState&) {
-  names.emplace_back(AtomicString(ctx(), "length"));
-  for (int i = 0; i < nodes_.size(); i++) {
+  unsigned size = length();
+  for (unsigned i = 0; i < size; i++) {
     names.emplace_back(AtomicString(ctx(), std::to_string(i)));
   }
 }
 
-void HTMLCollection::Trace(GCVisitor* visitor) const {}
+void HTMLCollection::InvalidateCache(Document* old_document) const {
+  collection_items_cache_.Invalidate();
+}
+
+Element* HTMLCollection::TraverseToFirst() const {
+  return ElementTraversal::FirstWithin(RootNode(), [this](const Element& element) { return ElementMatches(element); });
+}
+
+Element* HTMLCollection::TraverseToLast() const {
+  return ElementTraversal::LastWithin(RootNode(), [this](const Element& element) { return ElementMatches(element); });
+}
+
+Element* HTMLCollection::TraverseForwardToOffset(unsigned offset,
+                                                 Element& current_element,
+                                                 unsigned& current_offset) const {
+  return TraverseMatchingElementsForwardToOffset(current_element, &RootNode(), offset, current_offset,
+                                                 [this](const Element& element) { return ElementMatches(element); });
+}
+
+Element* HTMLCollection::TraverseBackwardToOffset(unsigned offset,
+                                                  Element& current_element,
+                                                  unsigned& current_offset) const {
+  return TraverseMatchingElementsBackwardToOffset(current_element, &RootNode(), offset, current_offset,
+                                                  [this](const Element& element) { return ElementMatches(element); });
+}
+
+bool HTMLCollection::ElementMatches(const Element& element) const {
+  // kDocAll collects every element, the other unnamed collections are not implemented yet.
+  return GetType() == kDocAll;
+}
+
+void HTMLCollection::Trace(GCVisitor* visitor) const {
+  collection_items_cache_.Trace(visitor);
+  LiveNodeListBase::Trace(visitor);
+}
 
 }  // namespace webf
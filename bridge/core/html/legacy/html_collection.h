@@ -1,17 +1,29 @@
+/*
+ * Copyright (C) 2019-2022 The Kraken authors. All rights reserved.
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
 #ifndef BRIDGE_CORE_HTML_HTML_COLLECTION_H_
 #define BRIDGE_CORE_HTML_HTML_COLLECTION_H_
 
-#include "bindings/qjs/heap_hashmap.h"
-#include "bindings/qjs/heap_vector.h"
 #include "bindings/qjs/script_wrappable.h"
-#include "core/dom/collection_items_cache.h"
+#include "core/dom/collection_index_cache.h"
 #include "core/dom/live_node_list_base.h"
 
 namespace webf {
 
-class HTMLCollection : public ScriptWrappable {
+// A live collection of the elements under its root which match ElementMatches(), in tree order.
+//
+// Items are resolved natively through CollectionIndexCache, so iterating over the collection by index costs O(1)
+// per step as long as the DOM tree is not changed in between.
+class HTMLCollection : public ScriptWrappable, public LiveNodeListBase {
+  DEFINE_WRAPPERTYPEINFO();
+
  public:
-  HTMLCollection(ContainerNode* base, CollectionType);
+  using ImplType = HTMLCollection*;
+
+  HTMLCollection(ContainerNode& base, CollectionType, NodeListInvalidationType);
+  HTMLCollection(ContainerNode& base, CollectionType);
 
   // DOM API
   unsigned length() const;
@@ -19,12 +31,23 @@ class HTMLCollection : public ScriptWrappable {
   bool NamedPropertyQuery(const AtomicString&, ExceptionState&);
   void NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState&);
 
+  // Non-DOM API
+  void InvalidateCache(Document* old_document = nullptr) const override;
+
+  // CollectionIndexCache API.
+  bool CanTraverseBackward() const { return true; }
+  Element* TraverseToFirst() const;
+  Element* TraverseToLast() const;
+  Element* TraverseForwardToOffset(unsigned offset, Element& current_element, unsigned& current_offset) const;
+  Element* TraverseBackwardToOffset(unsigned offset, Element& current_element, unsigned& current_offset) const;
+
   void Trace(GCVisitor*) const override;
 
+ protected:
+  virtual bool ElementMatches(const Element&) const;
+
  private:
-  CollectionType type_;
-  ContainerNode* base_;
-  std::vector<Element> nodes_;
+  mutable CollectionIndexCache<HTMLCollection, Element> collection_items_cache_;
 };
 
 }  // namespace webf
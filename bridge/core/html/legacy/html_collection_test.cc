@@ -31,3 +31,70 @@ TEST(HTMLCollection, children) {
 
   EXPECT_EQ(errorCalled, false);
 }
+
+TEST(HTMLCollection, getElementsByClassNameIsLive) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "0 2 true 1 0 2");
+    logCalled = true;
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let items = document.getElementsByClassName('item  active');"
+      "let before = items.length;"
+      "let a = document.createElement('div');"
+      "let b = document.createElement('p');"
+      "a.className = 'active item';"
+      "b.setAttribute('class', 'item active extra');"
+      "document.body.appendChild(a);"
+      "document.body.appendChild(b);"
+      "let added = items.length;"
+      "let ordered = items[0] === a && items.item(1) === b;"
+      "a.className = 'item';"
+      "let changed = items.length;"
+      "document.body.removeChild(b);"
+      "let removed = items.length;"
+      "a.className = 'item active';"
+      "let nested = document.createElement('span');"
+      "nested.className = 'active item';"
+      "a.appendChild(nested);"
+      "console.log(before, added, ordered, changed, removed, items.length);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(HTMLCollection, getElementsByTagName) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "3 3 1 2 100 true");
+    logCalled = true;
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let container = document.createElement('div');"
+      "container.innerHTML = '<span></span><p><span></span></p><span></span>';"
+      "document.body.appendChild(container);"
+      "let spans = container.getElementsByTagName('SPAN');"
+      "let length = spans.length;"
+      "let all = container.getElementsByTagName('*').length;"
+      "container.removeChild(container.firstChild);"
+      "let divs = document.getElementsByTagName('div');"
+      "for (let i = 0; i < 98; i ++) container.appendChild(document.createElement('span'));"
+      "let count = 0;"
+      "for (let i = 0; i < spans.length; i ++) { if (spans[i].tagName === 'SPAN') count ++; }"
+      "console.log(length, all - 1, divs.length, spans.length - 98, count, spans[100] === undefined);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
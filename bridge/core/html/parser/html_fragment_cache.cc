@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "html_fragment_cache.h"
+#include <vector>
+#include "core/dom/comment.h"
+#include "core/dom/document.h"
+#include "core/dom/document_fragment.h"
+#include "core/dom/element.h"
+#include "core/dom/node_traversal.h"
+#include "core/dom/text.h"
+#include "foundation/ascii_types.h"
+#include "html_parser.h"
+
+namespace webf {
+
+// Longer markup is rarely repeated, and keeping it would hold too much memory.
+static const size_t kMaximumHTMLFragmentCacheMarkupLength = 16 * 1024;
+static const size_t kMaximumHTMLFragmentCacheSize = 64;
+static const size_t kMaximumHTMLFragmentCacheSeenSize = 1024;
+
+bool HTMLFragmentCache::IsCacheable(const std::string& html) {
+  if (html.length() > kMaximumHTMLFragmentCacheMarkupLength)
+    return false;
+
+  // Scripts are evaluated by the parser, they must run for every innerHTML.
+  static const char kScriptTag[] = "<script";
+  const size_t script_tag_length = sizeof(kScriptTag) - 1;
+  for (size_t i = html.find('<'); i != std::string::npos && i + script_tag_length <= html.length();
+       i = html.find('<', i + 1)) {
+    size_t j = 1;
+    while (j < script_tag_length && ToASCIILower(html[i + j]) == kScriptTag[j]) {
+      j++;
+    }
+    if (j == script_tag_length)
+      return false;
+  }
+  return true;
+}
+
+bool HTMLFragmentCache::ReplaceChildren(ContainerNode& root, const std::string& html) {
+  if (!IsCacheable(html)) {
+    stats_.bypasses++;
+    return false;
+  }
+
+  auto it = entries_.find(html);
+  if (it != entries_.end()) {
+    stats_.hits++;
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    root.RemoveChildren();
+    CloneChildren(*it->second.prototype, root);
+    return true;
+  }
+
+  stats_.misses++;
+  size_t hash = std::hash<std::string>()(html);
+  if (seen_.count(hash) == 0) {
+    if (seen_.size() >= kMaximumHTMLFragmentCacheSeenSize)
+      seen_.clear();
+    seen_.emplace(hash);
+    return false;
+  }
+  seen_.erase(hash);
+
+  if (entries_.size() >= kMaximumHTMLFragmentCacheSize) {
+    auto least_recently_used = entries_.find(*lru_.back());
+    lru_.pop_back();
+    least_recently_used->second.prototype.Clear();
+    entries_.erase(least_recently_used);
+  }
+
+  DocumentFragment* prototype = DocumentFragment::Create(root.GetDocument());
+  HTMLParser::parseHTMLFragment(html.c_str(), html.length(), prototype);
+  auto inserted = entries_.emplace(html, Entry{prototype, {}}).first;
+  lru_.emplace_front(&inserted->first);
+  inserted->second.lru_position = lru_.begin();
+
+  root.RemoveChildren();
+  CloneChildren(*prototype, root);
+  return true;
+}
+
+void HTMLFragmentCache::CloneChildren(DocumentFragment& prototype, ContainerNode& root) {
+  Document& document = root.GetDocument();
+  // Ids of the clones in tree order, dart side pairs them with the nodes of its copy of the prototype.
+  std::string clone_ids;
+  // The prototype containers on the path to the current node, and their clones.
+  std::vector<std::pair<const ContainerNode*, ContainerNode*>> ancestors{{&prototype, &root}};
+
+  for (Node* node = NodeTraversal::Next(prototype, &prototype); node != nullptr;
+       node = NodeTraversal::Next(*node, &prototype)) {
+    while (ancestors.back().first != node->parentNode()) {
+      ancestors.pop_back();
+    }
+
+    Node* clone;
+    if (auto* element = DynamicTo<Element>(node)) {
+      clone = &element->CloneWithoutChildren(&document);
+    } else if (auto* text = DynamicTo<Text>(node)) {
+      clone = document.createTextNode(text->data(), ASSERT_NO_EXCEPTION());
+    } else {
+      clone = Comment::Create(document);
+    }
+    ancestors.back().second->AppendChildWithoutUICommand(*clone);
+
+    if (!clone_ids.empty())
+      clone_ids += ',';
+    clone_ids += std::to_string(clone->eventTargetId());
+
+    if (node->hasChildren()) {
+      ancestors.emplace_back(To<ContainerNode>(node), To<ContainerNode>(clone));
+    }
+  }
+
+  if (clone_ids.empty())
+    return;
+
+  document.GetExecutingContext()->uiCommandBuffer()->addCommand(
+      root.eventTargetId(), UICommand::kCloneSubtree, std::to_string(prototype.eventTargetId()), clone_ids, nullptr);
+}
+
+void HTMLFragmentCache::Trace(GCVisitor* visitor) const {
+  for (auto& entry : entries_) {
+    visitor->Trace(entry.second.prototype);
+  }
+}
+
+}  // namespace webf
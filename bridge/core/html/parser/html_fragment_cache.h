@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_HTML_PARSER_HTML_FRAGMENT_CACHE_H_
+#define BRIDGE_CORE_HTML_PARSER_HTML_FRAGMENT_CACHE_H_
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "bindings/qjs/cppgc/member.h"
+
+namespace webf {
+
+class ContainerNode;
+class Document;
+class DocumentFragment;
+class GCVisitor;
+
+struct HTMLFragmentCacheStats {
+  // innerHTML served by cloning a cached fragment.
+  int64_t hits{0};
+  // Cacheable markup which had to be parsed.
+  int64_t misses{0};
+  // Markup which is never cached, e.g. too long or containing scripts.
+  int64_t bypasses{0};
+};
+
+// Parsed innerHTML fragments of a document, keyed by the markup.
+//
+// Markup set repeatedly (e.g. the template of list items) is parsed once into a detached prototype fragment, then
+// every instantiation clones the prototype natively. The clones are created without per node attribute, style or
+// insertion commands, a single kCloneSubtree command lets dart side copy the prototype subtree at once.
+//
+// Markup is cached on its second use, so that markup which is only set once doesn't pay for the prototype. When the
+// cache is full, the least recently used entry is evicted.
+class HTMLFragmentCache {
+ public:
+  // Replace the children of |root| with the nodes of |html| from the cache. Returns false when |html| is not served
+  // by the cache, the caller should parse it.
+  bool ReplaceChildren(ContainerNode& root, const std::string& html);
+
+  const HTMLFragmentCacheStats& Stats() const { return stats_; }
+
+  void Trace(GCVisitor* visitor) const;
+
+ private:
+  static bool IsCacheable(const std::string& html);
+  static void CloneChildren(DocumentFragment& prototype, ContainerNode& root);
+
+  struct Entry {
+    Member<DocumentFragment> prototype;
+    // Position of the entry in lru_.
+    std::list<const std::string*>::iterator lru_position;
+  };
+
+  std::unordered_map<std::string, Entry> entries_;
+  // Keys of entries_, the most recently used first.
+  std::list<const std::string*> lru_;
+  // Hashes of markup used once.
+  std::unordered_set<size_t> seen_;
+  HTMLFragmentCacheStats stats_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_HTML_PARSER_HTML_FRAGMENT_CACHE_H_
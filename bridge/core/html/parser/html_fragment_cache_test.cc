@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "html_fragment_cache.h"
+#include "core/dom/document.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(HTMLFragmentCache, cloneRepeatedMarkup) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "3 3 true <span class=\"name\" style=\"color: red;\">item</span>");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* context = bridge->GetExecutingContext();
+  const char* code =
+      "for (let i = 0; i < 3; i++) {"
+      "  let li = document.createElement('li');"
+      "  li.innerHTML = '<span class=\"name\" style=\"color:red\">item</span><b id=\"b' + i + '\"></b>';"
+      "  document.body.appendChild(li);"
+      "}"
+      "let first = document.querySelector('li');"
+      "first.innerHTML = '<span class=\"name\" style=\"color:red\">item</span><b id=\"b0\"></b>';"
+      "let repeated = document.createElement('li');"
+      "repeated.innerHTML = '<span class=\"name\" style=\"color:red\">item</span><b id=\"b0\"></b>';"
+      "document.body.appendChild(repeated);"
+      "console.log(document.querySelectorAll('.name').length - 1, document.querySelectorAll('b').length - 1,"
+      "  repeated.lastChild.id === 'b0', repeated.firstChild.outerHTML);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  auto& stats = context->document()->GetHTMLFragmentCache().Stats();
+  EXPECT_EQ(stats.misses, 4);
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(HTMLFragmentCache, singleCommandForClonedSubtree) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  const char* code =
+      "let div = document.createElement('div');"
+      "div.innerHTML = '<p class=\"a\"><span>1</span></p><p class=\"b\"></p>';"
+      "div.innerHTML = '<p class=\"a\"><span>1</span></p><p class=\"b\"></p>';";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  buffer->SetCoalescingEnabled(false);
+  const char* clone = "div.innerHTML = '<p class=\"a\"><span>1</span></p><p class=\"b\"></p>';";
+  bridge->evaluateScript(clone, strlen(clone), "vm://", 0);
+
+  UICommandItem* items = buffer->data();
+  int clone_subtree = 0;
+  int per_node = 0;
+  for (int64_t i = 0; i < buffer->size(); i++) {
+    auto type = static_cast<UICommand>(items[i].type);
+    if (type == UICommand::kCloneSubtree) {
+      clone_subtree++;
+    } else if (type == UICommand::kSetAttribute || type == UICommand::kInsertAdjacentNode ||
+               type == UICommand::kCloneNode) {
+      per_node++;
+    }
+  }
+  EXPECT_EQ(clone_subtree, 1);
+  EXPECT_EQ(per_node, 0);
+  EXPECT_EQ(context->document()->GetHTMLFragmentCache().Stats().hits, 1);
+  buffer->clear();
+}
+
+TEST(HTMLFragmentCache, markupWithScriptIsNotCached) {
+  bool static errorCalled = false;
+  static int logCount = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) { logCount++; };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* context = bridge->GetExecutingContext();
+  const char* code =
+      "let div = document.createElement('div');"
+      "for (let i = 0; i < 3; i++) { div.innerHTML = '<SCRIPT>console.log(1)</SCRIPT>'; }";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(logCount, 3);
+  EXPECT_EQ(context->document()->GetHTMLFragmentCache().Stats().bypasses, 3);
+  EXPECT_EQ(context->document()->GetHTMLFragmentCache().Stats().hits, 0);
+  EXPECT_EQ(errorCalled, false);
+}
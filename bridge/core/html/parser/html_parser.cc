@@ -13,38 +13,37 @@
 
 namespace webf {
 
-inline std::string trim(const std::string& str) {
-  std::string tmp = str;
-  tmp.erase(0, tmp.find_first_not_of(' '));  // prefixing spaces
-  tmp.erase(tmp.find_last_not_of(' ') + 1);  // surfixing spaces
-  return tmp;
+// Only spaces, nothing to parse.
+static bool IsBlank(const char* html, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (html[i] != ' ')
+      return false;
+  }
+  return true;
+}
+
+static std::string GetTagName(GumboNode* node) {
+  if (node->v.element.tag != GUMBO_TAG_UNKNOWN)
+    return gumbo_normalized_tagname(node->v.element.tag);
+  GumboStringPiece piece = node->v.element.original_tag;
+  gumbo_tag_from_original_text(&piece);
+  return std::string(piece.data, piece.length);
 }
 
 // Parse html,isHTMLFragment should be false if need to automatically complete html, head, and body when they are
 // missing.
-GumboOutput* parse(const std::string& html, bool isHTMLFragment = false) {
+static GumboOutput* parse(const char* html, size_t length, bool isHTMLFragment = false) {
   // Gumbo-parser parse HTML.
-  GumboOutput* htmlTree = gumbo_parse_with_options(&kGumboDefaultOptions, html.c_str(), html.length());
+  GumboOutput* htmlTree = gumbo_parse_with_options(&kGumboDefaultOptions, html, length);
 
   if (isHTMLFragment) {
     // Find body.
     const GumboVector* children = &htmlTree->root->v.element.children;
     for (int i = 0; i < children->length; ++i) {
       auto* child = (GumboNode*)children->data[i];
-      if (child->type == GUMBO_NODE_ELEMENT) {
-        std::string tagName;
-        if (child->v.element.tag != GUMBO_TAG_UNKNOWN) {
-          tagName = gumbo_normalized_tagname(child->v.element.tag);
-        } else {
-          GumboStringPiece piece = child->v.element.original_tag;
-          gumbo_tag_from_original_text(&piece);
-          tagName = std::string(piece.data, piece.length);
-        }
-
-        if (tagName.compare("body") == 0) {
-          htmlTree->root = child;
-          break;
-        }
+      if (child->type == GUMBO_NODE_ELEMENT && GetTagName(child) == "body") {
+        htmlTree->root = child;
+        break;
       }
     }
   }
@@ -52,78 +51,155 @@ GumboOutput* parse(const std::string& html, bool isHTMLFragment = false) {
   return htmlTree;
 }
 
-void HTMLParser::traverseHTML(Node* root_node, GumboNode* node) {
-  auto* context = root_node->GetExecutingContext();
-  JSContext* ctx = root_node->GetExecutingContext()->ctx();
+HTMLParser::HTMLParser(ContainerNode* root_node, bool is_html_fragment)
+    : root_node_(root_node), is_html_fragment_(is_html_fragment) {}
 
-  const GumboVector* children = &node->v.element.children;
-  for (int i = 0; i < children->length; ++i) {
-    auto* child = (GumboNode*)children->data[i];
+HTMLParser::~HTMLParser() {
+  ReleaseOutput();
+}
 
-    if (auto* root_container = DynamicTo<ContainerNode>(root_node)) {
-      if (child->type == GUMBO_NODE_ELEMENT) {
-        std::string tagName;
-        if (child->v.element.tag != GUMBO_TAG_UNKNOWN) {
-          tagName = gumbo_normalized_tagname(child->v.element.tag);
-        } else {
-          GumboStringPiece piece = child->v.element.original_tag;
-          gumbo_tag_from_original_text(&piece);
-          tagName = std::string(piece.data, piece.length);
-        }
+void HTMLParser::StartWithOwnedInput(char* html, size_t length) {
+  // Gumbo keeps pointers to the input in its output, e.g. the original names of unknown tags.
+  owned_input_.reset(html);
+  Start(html, length);
+}
 
-        auto* element = context->document()->createElement(AtomicString(ctx, tagName), ASSERT_NO_EXCEPTION());
-        root_container->AppendChild(element);
-        parseProperty(element, &child->v.element);
+bool HTMLParser::Pump(std::chrono::steady_clock::duration budget) {
+  if (finished_)
+    return true;
+  assert(output_ != nullptr);
+  auto now = std::chrono::steady_clock::now();
+  auto deadline = budget >= std::chrono::steady_clock::time_point::max() - now
+                      ? std::chrono::steady_clock::time_point::max()
+                      : now + budget;
+  return BuildTree(deadline);
+}
+
+void HTMLParser::Start(const char* html, size_t length) {
+  assert(output_ == nullptr && !finished_);
+  root_node_->RemoveChildren();
+  if (IsBlank(html, length)) {
+    ReleaseOutput();
+    finished_ = true;
+    return;
+  }
+
+  output_ = parse(html, length, is_html_fragment_);
+  PushStack(output_->root, root_node_);
+}
+
+void HTMLParser::PushStack(GumboNode* node, ContainerNode* parent) {
+  parent->RetainWrapper();
+  stack_.push_back({node, 0, parent});
+}
+
+void HTMLParser::PopStack() {
+  ContainerNode* parent = stack_.back().parent;
+  stack_.pop_back();
+  parent->ReleaseWrapper();
+}
 
+bool HTMLParser::BuildTree(std::chrono::steady_clock::time_point deadline) {
+  // Reading the clock is not free, check the deadline once every few nodes.
+  const unsigned kNodesPerDeadlineCheck = 32;
+
+  auto* context = root_node_->GetExecutingContext();
+  JSContext* ctx = context->ctx();
+  unsigned inserted_nodes = 0;
+
+  while (!stack_.empty()) {
+    StackEntry& entry = stack_.back();
+    const GumboVector* children = &entry.node->v.element.children;
+    if (entry.next_child >= children->length) {
+      PopStack();
+      continue;
+    }
+
+    auto* child = (GumboNode*)children->data[entry.next_child++];
+    // |entry| is invalidated by pushing to the stack below.
+    ContainerNode* parent = entry.parent;
+
+    // The nodes inserted into a connected parent are kept alive by the document until script sees them, the nodes
+    // inserted into a detached parent are only kept alive by their JS object.
+    bool defer_wrappers = parent->isConnected();
+
+    if (child->type == GUMBO_NODE_ELEMENT) {
+      Element* element;
+      {
+        DeferredWrapperCreationScope scope(context, defer_wrappers);
+        element = context->document()->createElement(AtomicString(ctx, GetTagName(child)), ASSERT_NO_EXCEPTION());
+      }
+      parent->AppendChild(element);
+      parseProperty(element, &child->v.element);
+
+      if (child->v.element.children.length > 0) {
         // eval javascript when <script>//code...</script>.
-        if (child->v.element.children.length > 0) {
-          if (child->v.element.tag == GUMBO_TAG_SCRIPT) {
-            const char* code = ((GumboNode*)child->v.element.children.data[0])->v.text.text;
-            context->FlushUICommand();
-            context->EvaluateJavaScript(code, strlen(code), "vm://", 0);
-          } else {
-            traverseHTML(element, child);
-          }
+        if (child->v.element.tag == GUMBO_TAG_SCRIPT) {
+          const char* code = ((GumboNode*)child->v.element.children.data[0])->v.text.text;
+          context->FlushUICommand();
+          context->EvaluateJavaScript(code, strlen(code), "vm://", 0);
+        } else {
+          PushStack(child, element);
         }
-      } else if (child->type == GUMBO_NODE_TEXT) {
-        auto* text = context->document()->createTextNode(AtomicString(ctx, child->v.text.text), ASSERT_NO_EXCEPTION());
-        root_container->AppendChild(text);
       }
+    } else if (child->type == GUMBO_NODE_TEXT) {
+      Text* text;
+      {
+        DeferredWrapperCreationScope scope(context, defer_wrappers);
+        text = context->document()->createTextNode(AtomicString(ctx, child->v.text.text), ASSERT_NO_EXCEPTION());
+      }
+      parent->AppendChild(text);
+    }
+
+    if (++inserted_nodes % kNodesPerDeadlineCheck == 0 && !stack_.empty() &&
+        std::chrono::steady_clock::now() >= deadline) {
+      return false;
     }
   }
+
+  ReleaseOutput();
+  finished_ = true;
+  return true;
 }
 
-bool HTMLParser::parseHTML(const std::string& html, Node* root_node, bool isHTMLFragment) {
-  if (root_node != nullptr) {
-    if (auto* root_container_node = DynamicTo<ContainerNode>(root_node)) {
-      root_container_node->RemoveChildren();
+void HTMLParser::ReleaseOutput() {
+  while (!stack_.empty()) {
+    PopStack();
+  }
+  if (output_ != nullptr) {
+    // Free gumbo parse nodes.
+    gumbo_destroy_output(&kGumboDefaultOptions, output_);
+    output_ = nullptr;
+  }
+  owned_input_.reset();
+}
 
-      if (!trim(html).empty()) {
-        GumboOutput* htmlTree = parse(html, isHTMLFragment);
-        traverseHTML(root_container_node, htmlTree->root);
-        // Free gumbo parse nodes.
-        gumbo_destroy_output(&kGumboDefaultOptions, htmlTree);
-      }
-    }
-  } else {
+bool HTMLParser::parseHTML(const char* code, size_t codeLength, Node* root_node, bool isHTMLFragment) {
+  if (root_node == nullptr) {
     WEBF_LOG(ERROR) << "Root node is null.";
+    return true;
+  }
+
+  if (auto* root_container_node = DynamicTo<ContainerNode>(root_node)) {
+    // The input is read in place and the whole tree is built at once, no copy is needed.
+    HTMLParser parser(root_container_node, isHTMLFragment);
+    parser.Start(code, codeLength);
+    parser.Pump(std::chrono::steady_clock::duration::max());
   }
 
   return true;
 }
 
 bool HTMLParser::parseHTML(const std::string& html, Node* root_node) {
-  return parseHTML(html, root_node, false);
+  return parseHTML(html.c_str(), html.length(), root_node, false);
 }
 
 bool HTMLParser::parseHTML(const char* code, size_t codeLength, Node* root_node) {
-  std::string html = std::string(code, codeLength);
-  return parseHTML(html, root_node, false);
+  return parseHTML(code, codeLength, root_node, false);
 }
 
 bool HTMLParser::parseHTMLFragment(const char* code, size_t codeLength, Node* rootNode) {
-  std::string html = std::string(code, codeLength);
-  return parseHTML(html, rootNode, true);
+  return parseHTML(code, codeLength, rootNode, true);
 }
 
 void HTMLParser::parseProperty(Element* element, GumboElement* gumboElement) {
@@ -134,30 +210,9 @@ void HTMLParser::parseProperty(Element* element, GumboElement* gumboElement) {
   for (int j = 0; j < attributes->length; ++j) {
     auto* attribute = (GumboAttribute*)attributes->data[j];
 
-    if (strcmp(attribute->name, "style") == 0) {
-      std::vector<std::string> arrStyles;
-      std::string::size_type prev_pos = 0, pos = 0;
-      std::string strStyles = attribute->value;
-
-      while ((pos = strStyles.find(';', pos)) != std::string::npos) {
-        arrStyles.push_back(strStyles.substr(prev_pos, pos - prev_pos));
-        prev_pos = ++pos;
-      }
-      arrStyles.push_back(strStyles.substr(prev_pos, pos - prev_pos));
-
-      auto* style = element->style();
-
-      for (auto& s : arrStyles) {
-        std::string::size_type position = s.find(':');
-        if (position != std::basic_string<char>::npos) {
-          std::string styleKey = s.substr(0, position);
-          trim(styleKey);
-          std::string styleValue = s.substr(position + 1, s.length());
-          trim(styleValue);
-          style->setProperty(AtomicString(ctx, styleKey), AtomicString(ctx, styleValue), ASSERT_NO_EXCEPTION());
-        }
-      }
-
+    auto* style = strcmp(attribute->name, "style") == 0 ? element->style() : nullptr;
+    if (style != nullptr) {
+      style->SetCSSText(attribute->value, strlen(attribute->value));
     } else {
       std::string strName = attribute->name;
       std::string strValue = attribute->value;
@@ -6,27 +6,73 @@
 #define BRIDGE_HTML_PARSER_H
 
 #include <third_party/gumbo-parser/src/gumbo.h>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
 #include <string>
+#include <vector>
 #include "foundation/native_string.h"
 
 namespace webf {
 
 class Node;
+class ContainerNode;
 class Element;
 class ExecutingContext;
 
+// Build DOM nodes from HTML source with gumbo-parser.
+//
+// The static methods parse and insert the whole document synchronously, reading the input in place.
+//
+// An HTMLParser instance inserts the nodes in slices: gumbo tokenizes the whole document in Start(), then Pump()
+// inserts nodes until a time budget is spent, so that building a large document doesn't block the JS thread in one
+// task.
+//
+// The tree is walked with an explicit stack, deep documents don't overflow the native stack.
+//
+// Nodes inserted into a connected parent defer the creation of their JS object until they are exposed to script, most
+// of the nodes of a static document never are.
 class HTMLParser {
  public:
   static bool parseHTML(const char* code, size_t codeLength, Node* rootNode);
   static bool parseHTML(const std::string& html, Node* rootNode);
   static bool parseHTMLFragment(const char* code, size_t codeLength, Node* rootNode);
 
+  HTMLParser(ContainerNode* root_node, bool is_html_fragment);
+  ~HTMLParser();
+
+  // Tokenize |html|, which is read in place and must outlive the parser. The children of the root node are replaced
+  // by the following Pump() calls.
+  void Start(const char* html, size_t length);
+  // Same as Start(), the parser takes the ownership of |html|, allocated with malloc().
+  void StartWithOwnedInput(char* html, size_t length);
+  // Insert parsed nodes until |budget| is spent. Returns true once the whole document was inserted.
+  bool Pump(std::chrono::steady_clock::duration budget);
+  bool IsFinished() const { return finished_; }
+
  private:
-  ExecutingContext* context_;
-  static void traverseHTML(Node* root, GumboNode* node);
+  struct StackEntry {
+    GumboNode* node;
+    unsigned next_child;
+    // The parent is retained while its children are inserted, scripts may detach it in between. Retaining doesn't
+    // create the JS object of a node built by the parser.
+    ContainerNode* parent;
+  };
+
+  static bool parseHTML(const char* code, size_t codeLength, Node* rootNode, bool isHTMLFragment);
+
+  void PushStack(GumboNode* node, ContainerNode* parent);
+  void PopStack();
+  bool BuildTree(std::chrono::steady_clock::time_point deadline);
+  void ReleaseOutput();
   static void parseProperty(Element* element, GumboElement* gumboElement);
 
-  static bool parseHTML(const std::string& html, Node* rootNode, bool isHTMLFragment);
+  ContainerNode* root_node_;
+  bool is_html_fragment_;
+  bool finished_{false};
+  std::unique_ptr<char, void (*)(void*)> owned_input_{nullptr, free};
+  GumboOutput* output_{nullptr};
+  std::vector<StackEntry> stack_;
 };
 }  // namespace webf
 
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "html_parser.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(HTMLParser, insertNodesInTimeSlices) {
+  bool static errorCalled = false;
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+
+  std::string html = "<body>";
+  for (int i = 0; i < 100; i++) {
+    html += "<span class=\"item\">" + std::to_string(i) + "</span>";
+  }
+  html += "<script>console.log(document.querySelectorAll('span').length)</script><p>end</p></body>";
+
+  // The page takes the ownership of the buffer.
+  auto* buffer = static_cast<char*>(malloc(html.length()));
+  memcpy(buffer, html.c_str(), html.length());
+  EXPECT_TRUE(bridge->parseHTMLInSlices(buffer, html.length()));
+
+  int slices = 1;
+  while (!bridge->pumpHTMLParser(0)) {
+    slices++;
+  }
+  EXPECT_GT(slices, 1);
+
+  const char* code = "console.log(document.querySelectorAll('.item').length, document.querySelector('p').textContent);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  ASSERT_EQ(logs.size(), 2);
+  // Scripts run once the nodes before them were inserted.
+  EXPECT_EQ(logs[0], "100");
+  EXPECT_EQ(logs[1], "100 end");
+}
+
+TEST(HTMLParser, deeplyNestedDocument) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "2000 deepest");
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+
+  const int kDepth = 2000;
+  std::string html = "<body>";
+  for (int i = 0; i < kDepth; i++) {
+    html += "<div>";
+  }
+  html += "deepest";
+  for (int i = 0; i < kDepth; i++) {
+    html += "</div>";
+  }
+  html += "</body>";
+  bridge->parseHTML(html.c_str(), html.length());
+
+  const char* code =
+      "let depth = 0;"
+      "let node = document.body;"
+      "while (node.firstElementChild) { node = node.firstElementChild; depth++; }"
+      "console.log(depth, node.textContent);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(HTMLParser, wrappersAreCreatedOnFirstExposure) {
+  bool static errorCalled = false;
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* context = bridge->GetExecutingContext();
+
+  size_t deferred_before = context->DeferredWrapperCount();
+  std::string html = "<body><div id=\"a\"><span>1</span><span>2</span></div></body>";
+  bridge->parseHTML(html.c_str(), html.length());
+  // head, body, the div, both spans and their texts.
+  size_t deferred = context->DeferredWrapperCount();
+  EXPECT_EQ(deferred - deferred_before, 7);
+
+  const char* code =
+      "window.saved = document.getElementById('a');"
+      "console.log(saved === document.body.firstChild, saved.firstChild.parentNode === saved,"
+      "  saved.firstChild === saved.firstChild);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  // The body, the div and its first span were exposed.
+  EXPECT_EQ(context->DeferredWrapperCount(), deferred - 3);
+
+  JS_RunGC(JS_GetRuntime(context->ctx()));
+  const char* code2 = "console.log(saved === document.getElementById('a'), saved.lastChild.textContent);";
+  bridge->evaluateScript(code2, strlen(code2), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  ASSERT_EQ(logs.size(), 2);
+  EXPECT_EQ(logs[0], "true true true");
+  EXPECT_EQ(logs[1], "true 2");
+}
+
+TEST(HTMLParser, removedDeferredNodesAreCollected) {
+  bool static errorCalled = false;
+  auto bridge = TEST_init([](int32_t contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* context = bridge->GetExecutingContext();
+  JSRuntime* runtime = JS_GetRuntime(context->ctx());
+
+  const int kItems = 100;
+  std::string html = "<body><div id=\"list\">";
+  for (int i = 0; i < kItems; i++) {
+    html += "<span>" + std::to_string(i) + "</span>";
+  }
+  html += "</div></body>";
+  bridge->parseHTML(html.c_str(), html.length());
+  size_t deferred = context->DeferredWrapperCount();
+
+  JS_RunGC(runtime);
+  JSMemoryUsage before;
+  JS_ComputeMemoryUsage(runtime, &before);
+
+  // The removed nodes get their JS object, the subtree is a cycle of parent and sibling links collected by GC.
+  const char* code = "document.body.removeChild(document.getElementById('list'));";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(context->DeferredWrapperCount(), deferred - 1 - 2 * kItems - 1);
+
+  JS_RunGC(runtime);
+  JSMemoryUsage after;
+  JS_ComputeMemoryUsage(runtime, &after);
+  // Only the body was exposed and is kept, none of the removed nodes leak.
+  EXPECT_LT(after.obj_count - before.obj_count, kItems);
+
+  EXPECT_EQ(errorCalled, false);
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "html_serializer.h"
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include "core/dom/character_data.h"
+#include "core/dom/document_fragment.h"
+#include "core/dom/element.h"
+#include "core/dom/text.h"
+#include "core/html/html_template_element.h"
+#include "element_attribute_names.h"
+#include "html_element_type_helper.h"
+
+namespace webf {
+
+namespace {
+
+// https://html.spec.whatwg.org/multipage/syntax.html#void-elements
+const char* kVoidElements[] = {"area", "base", "br",   "col",   "embed",  "hr",    "img",
+                               "input", "link", "meta", "param", "source", "track", "wbr"};
+// Text children of these elements are serialized as is.
+const char* kRawTextElements[] = {"style", "script", "xmp", "iframe", "noembed", "noframes", "plaintext", "noscript"};
+
+template <typename CharType>
+bool EqualIgnoringASCIICase(const CharType* characters, unsigned length, const char* lower_name) {
+  if (strlen(lower_name) != length)
+    return false;
+  for (unsigned i = 0; i < length; i++) {
+    if (ToASCIILower(characters[i]) != lower_name[i])
+      return false;
+  }
+  return true;
+}
+
+template <size_t N>
+bool TagNameIsOneOf(const Element& element, const char* (&names)[N]) {
+  StringView tag_name = element.LocalName().ToStringView();
+  for (const char* name : names) {
+    if (tag_name.Is8Bit() ? EqualIgnoringASCIICase(tag_name.Characters8(), tag_name.length(), name)
+                          : EqualIgnoringASCIICase(tag_name.Characters16(), tag_name.length(), name))
+      return true;
+  }
+  return false;
+}
+
+// The node whose children are serialized for |element|, the children of a <template> live in its content fragment.
+ContainerNode* ChildrenContainer(Element& element) {
+  if (auto* template_element = DynamicTo<HTMLTemplateElement>(element)) {
+    return template_element->content();
+  }
+  return &element;
+}
+
+}  // namespace
+
+ScriptValue HTMLSerializer::Serialize(Node& node, ChildrenOnly children_only) {
+  JSContext* ctx = node.ctx();
+  HTMLSerializer serializer(ctx);
+
+  if (children_only == ChildrenOnly::kIncludeNode) {
+    serializer.SerializeNode(node);
+  } else if (auto* element = DynamicTo<Element>(node)) {
+    serializer.SerializeChildren(*ChildrenContainer(*element));
+  } else if (auto* container = DynamicTo<ContainerNode>(node)) {
+    serializer.SerializeChildren(*container);
+  }
+
+  JSValue result = serializer.builder_.ToQuickJS(ctx);
+  ScriptValue value = ScriptValue(ctx, result);
+  JS_FreeValue(ctx, result);
+  return value;
+}
+
+void HTMLSerializer::SerializeNode(Node& node) {
+  auto* element = DynamicTo<Element>(node);
+  if (element == nullptr) {
+    if (auto* container = DynamicTo<ContainerNode>(node)) {
+      SerializeChildren(*container);
+    } else {
+      AppendText(node);
+    }
+    return;
+  }
+
+  AppendStartTag(*element);
+  if (TagNameIsOneOf(*element, kVoidElements))
+    return;
+  SerializeChildren(*ChildrenContainer(*element));
+  AppendEndTag(*element);
+}
+
+void HTMLSerializer::SerializeChildren(ContainerNode& container) {
+  // Elements whose end tag is still pending, the innermost one at the back.
+  std::vector<Element*> open_elements;
+  Node* node = container.firstChild();
+
+  while (node != nullptr) {
+    if (auto* element = DynamicTo<Element>(node)) {
+      AppendStartTag(*element);
+      if (!TagNameIsOneOf(*element, kVoidElements)) {
+        Node* first_child = ChildrenContainer(*element)->firstChild();
+        if (first_child != nullptr) {
+          open_elements.push_back(element);
+          node = first_child;
+          continue;
+        }
+        AppendEndTag(*element);
+      }
+    } else {
+      AppendText(*node);
+    }
+
+    // Move to the next sibling, closing the elements whose last child was written.
+    Node* next = node->nextSibling();
+    while (next == nullptr && !open_elements.empty()) {
+      Element* parent = open_elements.back();
+      open_elements.pop_back();
+      AppendEndTag(*parent);
+      next = parent->nextSibling();
+    }
+    node = next;
+  }
+}
+
+void HTMLSerializer::AppendStartTag(Element& element) {
+  builder_.Append('<');
+  builder_.Append(element.LocalName().ToStringView());
+
+  if (const ElementAttributes* attributes = element.GetElementAttributes()) {
+    for (auto& attribute : attributes->Attributes()) {
+      // Serialized from the inline style below.
+      if (attribute.first == element_attribute_names::kstyle && element.InlineStyle() != nullptr)
+        continue;
+      AppendAttribute(attribute.first, attribute.second);
+    }
+  }
+  AppendStyleAttribute(element);
+
+  builder_.Append('>');
+}
+
+void HTMLSerializer::AppendEndTag(Element& element) {
+  builder_.Append("</", 2);
+  builder_.Append(element.LocalName().ToStringView());
+  builder_.Append('>');
+}
+
+void HTMLSerializer::AppendAttribute(const AtomicString& name, const AtomicString& value) {
+  builder_.Append(' ');
+  builder_.Append(name.ToStringView());
+  builder_.Append("=\"", 2);
+  AppendEscaped(value.ToStringView(), EscapeMode::kAttribute);
+  builder_.Append('"');
+}
+
+void HTMLSerializer::AppendStyleAttribute(Element& element) {
+  const CSSStyleDeclaration* style = element.InlineStyle();
+  if (style == nullptr || style->length() == 0)
+    return;
+
+  auto append_declaration = [this](const char* name, size_t length, const AtomicString& value) {
+    builder_.Append(name, length);
+    builder_.Append(": ", 2);
+    AppendEscaped(value.ToStringView(), EscapeMode::kAttribute);
+    builder_.Append(';');
+  };
+
+  builder_.Append(" style=\"", 8);
+  for (auto& property : style->Properties()) {
+    const char* name = kCSSPropertyIDCSSNames[static_cast<int32_t>(property.first)];
+    append_declaration(name, strlen(name), property.second);
+  }
+  for (auto& property : style->CustomProperties()) {
+    append_declaration(property.first.c_str(), property.first.length(), property.second);
+  }
+  builder_.Append('"');
+}
+
+void HTMLSerializer::AppendText(Node& node) {
+  if (node.IsTextNode()) {
+    auto* parent = DynamicTo<Element>(node.parentNode());
+    if (parent != nullptr && TagNameIsOneOf(*parent, kRawTextElements)) {
+      builder_.Append(To<Text>(node).data().ToStringView());
+    } else {
+      AppendEscaped(To<Text>(node).data().ToStringView(), EscapeMode::kText);
+    }
+  } else if (node.nodeType() == Node::kCommentNode) {
+    builder_.Append("<!--", 4);
+    builder_.Append(To<CharacterData>(node).data().ToStringView());
+    builder_.Append("-->", 3);
+  }
+}
+
+void HTMLSerializer::AppendEscaped(const StringView& string, EscapeMode mode) {
+  if (string.Is8Bit()) {
+    AppendEscaped(string.Characters8(), string.length(), mode);
+  } else {
+    AppendEscaped(string.Characters16(), string.length(), mode);
+  }
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#escapingString
+template <typename CharType>
+void HTMLSerializer::AppendEscaped(const CharType* characters, size_t length, EscapeMode mode) {
+  size_t start = 0;
+  for (size_t i = 0; i < length; i++) {
+    const char* entity;
+    size_t entity_length;
+    auto c = static_cast<char16_t>(static_cast<typename std::make_unsigned<CharType>::type>(characters[i]));
+    if (c == '&') {
+      entity = "&amp;";
+      entity_length = 5;
+    } else if (c == 0xA0) {
+      entity = "&nbsp;";
+      entity_length = 6;
+    } else if (c == '"' && mode == EscapeMode::kAttribute) {
+      entity = "&quot;";
+      entity_length = 6;
+    } else if (c == '<' && mode == EscapeMode::kText) {
+      entity = "&lt;";
+      entity_length = 4;
+    } else if (c == '>' && mode == EscapeMode::kText) {
+      entity = "&gt;";
+      entity_length = 4;
+    } else {
+      continue;
+    }
+    builder_.Append(characters + start, i - start);
+    builder_.Append(entity, entity_length);
+    start = i + 1;
+  }
+  builder_.Append(characters + start, length - start);
+}
+
+}  // namespace webf
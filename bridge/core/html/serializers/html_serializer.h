@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_HTML_SERIALIZERS_HTML_SERIALIZER_H_
+#define BRIDGE_CORE_HTML_SERIALIZERS_HTML_SERIALIZER_H_
+
+#include "bindings/qjs/script_value.h"
+#include "foundation/string_builder.h"
+
+namespace webf {
+
+class Node;
+class Element;
+class ContainerNode;
+
+// Serialize a subtree to HTML for innerHTML and outerHTML, following
+// https://html.spec.whatwg.org/multipage/parsing.html#serialising-html-fragments
+//
+// The subtree is walked iteratively and written into one StringBuilder, then converted to a JS string once.
+class HTMLSerializer {
+ public:
+  enum class ChildrenOnly { kIncludeNode, kChildrenOnly };
+
+  static ScriptValue Serialize(Node& node, ChildrenOnly children_only);
+
+ private:
+  enum class EscapeMode { kText, kAttribute };
+
+  explicit HTMLSerializer(JSContext* ctx) : ctx_(ctx) {}
+
+  void SerializeNode(Node& node);
+  void SerializeChildren(ContainerNode& container);
+
+  void AppendStartTag(Element& element);
+  void AppendEndTag(Element& element);
+  void AppendAttribute(const AtomicString& name, const AtomicString& value);
+  void AppendStyleAttribute(Element& element);
+  void AppendText(Node& text);
+  void AppendEscaped(const StringView& string, EscapeMode mode);
+  template <typename CharType>
+  void AppendEscaped(const CharType* characters, size_t length, EscapeMode mode);
+
+  JSContext* ctx_;
+  StringBuilder builder_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_HTML_SERIALIZERS_HTML_SERIALIZER_H_
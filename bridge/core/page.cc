@@ -26,7 +26,7 @@ WebFPage::WebFPage(DartContext* dart_context, int32_t contextId, const JSExcepti
   context_ = new ExecutingContext(
       dart_context, contextId,
       [](ExecutingContext* context, const char* message) {
-        if (context->dartMethodPtr()->onJsError != nullptr) {
+        if (context->IsBoundToContextId() && context->dartMethodPtr()->onJsError != nullptr) {
           context->dartMethodPtr()->onJsError(context->contextId(), message);
         }
         WEBF_LOG(ERROR) << message << std::endl;
@@ -34,6 +34,11 @@ WebFPage::WebFPage(DartContext* dart_context, int32_t contextId, const JSExcepti
       this);
 }
 
+void WebFPage::BindContextId(int32_t id) {
+  contextId = id;
+  context_->BindContextId(id);
+}
+
 bool WebFPage::parseHTML(const char* code, size_t length) {
   if (!context_->IsContextValid())
     return false;
@@ -50,6 +55,39 @@ bool WebFPage::parseHTML(const char* code, size_t length) {
   return true;
 }
 
+bool WebFPage::parseHTMLInSlices(char* code, size_t length) {
+  if (!context_->IsContextValid()) {
+    free(code);
+    return false;
+  }
+
+  MemberMutationScope scope{context_};
+
+  auto document_element = context_->document()->documentElement();
+  if (!document_element) {
+    free(code);
+    return false;
+  }
+
+  html_parser_ = std::make_unique<HTMLParser>(document_element, false);
+  html_parser_->StartWithOwnedInput(code, length);
+
+  return true;
+}
+
+bool WebFPage::pumpHTMLParser(int64_t budget_us) {
+  if (html_parser_ == nullptr || !context_->IsContextValid())
+    return true;
+
+  MemberMutationScope scope{context_};
+
+  if (!html_parser_->Pump(std::chrono::microseconds(budget_us)))
+    return false;
+
+  html_parser_ = nullptr;
+  return true;
+}
+
 NativeValue* WebFPage::invokeModuleEvent(const NativeString* native_module_name,
                                          const char* eventType,
                                          void* ptr,
@@ -143,6 +181,8 @@ WebFPage::~WebFPage() {
     disposeCallback(this);
   }
 #endif
+  // The parser holds JS values of the nodes under construction, release them before the context.
+  html_parser_ = nullptr;
   delete context_;
 }
 
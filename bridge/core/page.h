@@ -9,6 +9,7 @@
 #include <quickjs/quickjs.h>
 #include <atomic>
 #include <deque>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -19,6 +20,7 @@ namespace webf {
 
 class WebFPage;
 class DartContext;
+class HTMLParser;
 
 using JSBridgeDisposeCallback = void (*)(WebFPage* bridge);
 using ConsoleMessageHandler = std::function<void(void* ctx, const std::string& message, int logLevel)>;
@@ -42,11 +44,19 @@ class WebFPage final {
   void evaluateScript(const NativeString* script, const char* url, int startLine);
   void evaluateScript(const uint16_t* script, size_t length, const char* url, int startLine);
   bool parseHTML(const char* code, size_t length);
+  // Parse the document HTML, the nodes are inserted by pumpHTMLParser(). The page takes the ownership of |code|,
+  // allocated with malloc().
+  bool parseHTMLInSlices(char* code, size_t length);
+  // Insert the parsed nodes for at most |budget_us| microseconds. Returns true when no parsing work is left.
+  bool pumpHTMLParser(int64_t budget_us);
+  // Evaluate UTF-8 source without copying it, |script|[length] must be a null character.
   void evaluateScript(const char* script, size_t length, const char* url, int startLine);
   uint8_t* dumpByteCode(const char* script, size_t length, const char* url, size_t* byteLength);
   void evaluateByteCode(uint8_t* bytes, size_t byteLength);
 
   std::thread::id currentThread() const;
+  // Hand a page built by PagePool to the context |id| of dart side.
+  void BindContextId(int32_t id);
 
   [[nodiscard]] ExecutingContext* GetExecutingContext() const { return context_; }
 
@@ -69,6 +79,7 @@ class WebFPage final {
   // maintainable.
   ExecutingContext* context_;
   JSExceptionHandler handler_;
+  std::unique_ptr<HTMLParser> html_parser_;
 };
 
 }  // namespace webf
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "page_pool.h"
+#include <algorithm>
+#include "dart_context.h"
+#include "page.h"
+
+namespace webf {
+
+PagePool::PagePool(DartContext* dart_context) : dart_context_(dart_context) {}
+
+PagePool::~PagePool() {
+  Clear();
+}
+
+void PagePool::SetCapacity(int32_t max_pages, int64_t max_bytes) {
+  max_pages_ = std::max(max_pages, 0);
+  max_bytes_ = std::max<int64_t>(max_bytes, 0);
+  Trim();
+}
+
+WebFPage* PagePool::Take(int32_t context_id) {
+  if (pages_.empty())
+    return nullptr;
+  WebFPage* page = pages_.front();
+  pages_.pop_front();
+  page->BindContextId(context_id);
+  return page;
+}
+
+bool PagePool::Fill() {
+  if (!HasRoom())
+    return false;
+
+  // Pages are built from the same bindings and polyfill, measuring the first one is enough. Computing the memory
+  // usage walks the whole heap, it is not repeated for every page. The JavaScript runtime is created by the
+  // first page of the dart context, which is not measured since it also carries the runtime.
+  JSRuntime* runtime = dart_context_->runtime();
+  bool measure = page_bytes_ == 0 && runtime != nullptr;
+  JSMemoryUsage before;
+  if (measure)
+    JS_ComputeMemoryUsage(runtime, &before);
+
+  auto* page = new WebFPage(dart_context_, ExecutingContext::kUnboundContextId, nullptr);
+
+  if (measure) {
+    JSMemoryUsage after;
+    JS_ComputeMemoryUsage(runtime, &after);
+    page_bytes_ = std::max<int64_t>(after.malloc_size - before.malloc_size, 1);
+  }
+
+  pages_.emplace_back(page);
+  Trim();
+  return HasRoom();
+}
+
+void PagePool::Clear() {
+  for (auto* page : pages_) {
+    delete page;
+  }
+  pages_.clear();
+}
+
+bool PagePool::HasRoom() const {
+  if (static_cast<int64_t>(pages_.size()) >= max_pages_)
+    return false;
+  return max_bytes_ == 0 || static_cast<int64_t>(pages_.size() + 1) * page_bytes_ <= max_bytes_;
+}
+
+void PagePool::Trim() {
+  while (!pages_.empty() && (static_cast<int64_t>(pages_.size()) > max_pages_ ||
+                             (max_bytes_ > 0 && static_cast<int64_t>(pages_.size()) * page_bytes_ > max_bytes_))) {
+    delete pages_.back();
+    pages_.pop_back();
+  }
+}
+
+}  // namespace webf
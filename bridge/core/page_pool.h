@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_PAGE_POOL_H_
+#define BRIDGE_CORE_PAGE_POOL_H_
+
+#include <cinttypes>
+#include <deque>
+#include "foundation/macros.h"
+
+namespace webf {
+
+class DartContext;
+class WebFPage;
+
+// Pages built ahead of time, with bindings and polyfill already evaluated, so that allocateNewPage() only has to bind
+// a context id and evaluate the plugins.
+//
+// The pool is empty until dart side gives it a capacity, and is filled one page at a time when dart side is idle.
+// Pages of the pool have no context id: they make no calls to dart side and their UI commands wait in their buffer
+// until the page is handed out. Plugins are not evaluated until then, since they may call dart side, e.g. with
+// setTimeout(), and plugins registered after the pages were built are still evaluated.
+//
+// Pooled pages count as running contexts of the dart context, so the JavaScript runtime is kept alive while the pool
+// holds pages, even after the last page handed out was disposed. It is disposed with the pool.
+class PagePool {
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(PagePool);
+
+ public:
+  explicit PagePool(DartContext* dart_context);
+  ~PagePool();
+
+  // At most |max_pages| pages, together using at most |max_bytes| of the JavaScript heap. A non-positive |max_bytes|
+  // only bounds the number of pages. Pages beyond a smaller capacity are disposed.
+  void SetCapacity(int32_t max_pages, int64_t max_bytes);
+  // Returns a pooled page bound to |context_id|, or nullptr when the pool is empty.
+  WebFPage* Take(int32_t context_id);
+  // Builds one page. Returns whether the pool still has room for more.
+  bool Fill();
+  // Disposes the pooled pages and keeps the capacity.
+  void Clear();
+
+  size_t size() const { return pages_.size(); }
+  // The JavaScript heap used by a page, measured while building the first one. 0 until then.
+  int64_t page_bytes() const { return page_bytes_; }
+
+ private:
+  bool HasRoom() const;
+  void Trim();
+
+  DartContext* dart_context_;
+  std::deque<WebFPage*> pages_;
+  int32_t max_pages_{0};
+  int64_t max_bytes_{0};
+  int64_t page_bytes_{0};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_PAGE_POOL_H_
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "page_pool.h"
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "include/webf_bridge.h"
+#include "page.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(PagePool, handOutPooledPages) {
+  static int logCount = 0;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCount++;
+    EXPECT_STREQ(message.c_str(), "DIV");
+  };
+  auto bridge = TEST_init();
+  PagePool* pool = bridge->GetExecutingContext()->dartContext()->pagePool();
+  EXPECT_EQ(fillPagePool(), 0);
+
+  setPagePoolCapacity(2, 0);
+  EXPECT_EQ(fillPagePool(), 1);
+  EXPECT_EQ(fillPagePool(), 0);
+  EXPECT_EQ(pool->size(), 2);
+  EXPECT_GT(pool->page_bytes(), 0);
+
+  // allocateNewPage() takes a pooled page and binds the requested context id.
+  auto page = TEST_init();
+  EXPECT_EQ(pool->size(), 1);
+  EXPECT_TRUE(page->GetExecutingContext()->IsBoundToContextId());
+  EXPECT_EQ(page->GetExecutingContext()->contextId(), page->contextId);
+  EXPECT_TRUE(isContextValid(page->contextId));
+
+  const char* code = "console.log(document.createElement('div').tagName);";
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(logCount, 1);
+
+  setPagePoolCapacity(0, 0);
+  EXPECT_EQ(pool->size(), 0);
+  webf::WebFPage::consoleMessageHandler = nullptr;
+}
+
+TEST(PagePool, boundedByMemory) {
+  auto bridge = TEST_init();
+  PagePool* pool = bridge->GetExecutingContext()->dartContext()->pagePool();
+  setPagePoolCapacity(8, 0);
+  fillPagePool();
+  int64_t page_bytes = pool->page_bytes();
+  ASSERT_GT(page_bytes, 0);
+
+  setPagePoolCapacity(8, page_bytes * 2);
+  while (fillPagePool()) {
+  }
+  EXPECT_EQ(pool->size(), 2);
+
+  // Pages beyond a smaller capacity are disposed.
+  setPagePoolCapacity(8, page_bytes);
+  EXPECT_EQ(pool->size(), 1);
+
+  setPagePoolCapacity(0, 0);
+  EXPECT_EQ(pool->size(), 0);
+}
+
+TEST(PagePool, pluginsAreEvaluatedOnceBound) {
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto bridge = TEST_init();
+  PagePool* pool = bridge->GetExecutingContext()->dartContext()->pagePool();
+  std::string code = "console.log('plugin'); setTimeout(function() { console.log('timer'); });";
+  registerPluginCode(code.c_str(), code.size(), "pool_test_plugin");
+
+  // The plugin calls dart side, it must not run in a page which has no context id yet.
+  setPagePoolCapacity(1, 0);
+  fillPagePool();
+  EXPECT_EQ(pool->size(), 1);
+  EXPECT_TRUE(logs.empty());
+
+  // TEST_init() would replace the timers of the test environment, the page is allocated directly.
+  auto* page = static_cast<WebFPage*>(allocateNewPage(999));
+  EXPECT_EQ(pool->size(), 0);
+  ASSERT_EQ(logs.size(), 1);
+  EXPECT_EQ(logs[0], "plugin");
+
+  // The timer was installed once the page was bound.
+  TEST_runLoop(page->GetExecutingContext());
+  ASSERT_EQ(logs.size(), 2);
+  EXPECT_EQ(logs[1], "timer");
+
+  disposePage(page);
+  setPagePoolCapacity(0, 0);
+  ExecutingContext::plugin_string_code.erase("pool_test_plugin");
+  webf::WebFPage::consoleMessageHandler = nullptr;
+}
+
+TEST(PagePool, timeOriginIsResetOnceBound) {
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto bridge = TEST_init();
+  setPagePoolCapacity(1, 0);
+  fillPagePool();
+  auto pooled_at = std::chrono::system_clock::now();
+  // The page sits idle in the pool before it is handed out.
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  auto* page = static_cast<WebFPage*>(allocateNewPage(998));
+  EXPECT_GE(page->GetExecutingContext()->timeOrigin() - pooled_at, std::chrono::milliseconds(200));
+  const char* code = "console.log(performance.now() < 100);";
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  ASSERT_EQ(logs.size(), 1);
+  EXPECT_EQ(logs[0], "true");
+
+  disposePage(page);
+  setPagePoolCapacity(0, 0);
+  webf::WebFPage::consoleMessageHandler = nullptr;
+}
@@ -10,6 +10,8 @@
 
 namespace webf {
 
+// Contexts of pages built ahead of time by PagePool are counted too: the runtime outlives the last page handed out
+// while the pool holds pages.
 thread_local std::atomic<int32_t> runningContexts{0};
 
 ScriptState::ScriptState(DartContext* dart_context) : dart_context_(dart_context) {
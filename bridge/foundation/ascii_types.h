@@ -79,6 +79,11 @@ inline bool IsASCIIUpper(CharType c) {
   return c >= 'A' && c <= 'Z';
 }
 
+template <typename CharType>
+inline CharType ToASCIILower(CharType c) {
+  return static_cast<CharType>(c | (IsASCIIUpper(c) << 5));
+}
+
 template <typename CharacterType>
 inline bool IsLowerASCII(const CharacterType* characters, size_t length) {
   bool contains_upper_case = false;
@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "dart_readable.h"
+#include <cstdlib>
+
+namespace webf {
+
+static thread_local int64_t dart_malloc_count = 0;
+
+void* dart_malloc(std::size_t size) {
+  dart_malloc_count++;
+  return malloc(size);
+}
+
+void dart_free(void* ptr) {
+  free(ptr);
+}
+
+int64_t DartMallocCount() {
+  return dart_malloc_count;
+}
+
+}  // namespace webf
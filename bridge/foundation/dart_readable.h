@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_FOUNDATION_DART_READABLE_H_
+#define BRIDGE_FOUNDATION_DART_READABLE_H_
+
+#include <cinttypes>
+#include <cstddef>
+
+namespace webf {
+
+// Allocate memory which may be handed over to dart side. Dart side releases it with malloc.free(), so it must come
+// from malloc().
+void* dart_malloc(std::size_t size);
+void dart_free(void* ptr);
+
+// Number of dart_malloc() calls made by the current thread, benchmarks use it to count allocations.
+int64_t DartMallocCount();
+
+}  // namespace webf
+
+#endif  // BRIDGE_FOUNDATION_DART_READABLE_H_
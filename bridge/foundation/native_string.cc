@@ -4,21 +4,22 @@
  */
 #include "native_string.h"
 #include <string>
+#include "dart_readable.h"
 
 namespace webf {
 
 NativeString::NativeString(const uint16_t* string, uint32_t length) : length_(length) {
-  string_ = static_cast<const uint16_t*>(malloc(length * sizeof(uint16_t)));
+  string_ = static_cast<const uint16_t*>(dart_malloc(length * sizeof(uint16_t)));
   memcpy((void*)string_, string, length * sizeof(uint16_t));
 }
 
 NativeString::NativeString(const NativeString* source) : length_(source->length()) {
-  string_ = static_cast<const uint16_t*>(malloc(source->length() * sizeof(uint16_t)));
+  string_ = static_cast<const uint16_t*>(dart_malloc(source->length() * sizeof(uint16_t)));
   memcpy((void*)string_, source->string_, source->length() * sizeof(u_int16_t));
 }
 
 NativeString::~NativeString() {
-  delete[] string_;
+  dart_free(const_cast<uint16_t*>(string_));
 }
 
 }  // namespace webf
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "string_builder.h"
+#include <cassert>
+#include "bindings/qjs/qjs_engine_patch.h"
+
+namespace webf {
+
+void StringBuilder::ReserveCapacity(size_t capacity) {
+  if (is_8bit_) {
+    buffer8_.reserve(capacity);
+  } else {
+    buffer16_.reserve(capacity);
+  }
+}
+
+void StringBuilder::Append(char16_t c) {
+  if (is_8bit_) {
+    if (IsASCII(c)) {
+      buffer8_.push_back(static_cast<char>(c));
+      return;
+    }
+    UpgradeTo16Bit();
+  }
+  buffer16_.push_back(c);
+}
+
+void StringBuilder::Append(const char* characters, size_t length) {
+  if (is_8bit_) {
+    size_t ascii_length = 0;
+    while (ascii_length < length && IsASCII(characters[ascii_length])) {
+      ascii_length++;
+    }
+    buffer8_.append(characters, ascii_length);
+    if (ascii_length == length)
+      return;
+    UpgradeTo16Bit();
+    characters += ascii_length;
+    length -= ascii_length;
+  }
+
+  size_t offset = buffer16_.length();
+  buffer16_.resize(offset + length);
+  for (size_t i = 0; i < length; i++) {
+    buffer16_[offset + i] = static_cast<unsigned char>(characters[i]);
+  }
+}
+
+void StringBuilder::Append(const char16_t* characters, size_t length) {
+  if (is_8bit_) {
+    size_t ascii_length = 0;
+    while (ascii_length < length && IsASCII(characters[ascii_length])) {
+      buffer8_.push_back(static_cast<char>(characters[ascii_length]));
+      ascii_length++;
+    }
+    if (ascii_length == length)
+      return;
+    UpgradeTo16Bit();
+    characters += ascii_length;
+    length -= ascii_length;
+  }
+  buffer16_.append(characters, length);
+}
+
+void StringBuilder::Append(const StringView& string) {
+  if (string.Is8Bit()) {
+    Append(string.Characters8(), string.length());
+  } else {
+    Append(string.Characters16(), string.length());
+  }
+}
+
+JSValue StringBuilder::ToQuickJS(JSContext* ctx) const {
+  if (is_8bit_) {
+    // Pure ASCII content is copied into an 8-bit JS string directly.
+    return JS_NewStringLen(ctx, buffer8_.data(), buffer8_.length());
+  }
+  return JS_NewUnicodeString(ctx, reinterpret_cast<const uint16_t*>(buffer16_.data()), buffer16_.length());
+}
+
+void StringBuilder::UpgradeTo16Bit() {
+  assert(is_8bit_);
+  buffer16_.reserve(buffer8_.capacity() > buffer8_.length() * 2 ? buffer8_.capacity() : buffer8_.length() * 2);
+  buffer16_.assign(buffer8_.begin(), buffer8_.end());
+  std::string().swap(buffer8_);
+  is_8bit_ = false;
+}
+
+}  // namespace webf
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_FOUNDATION_STRING_BUILDER_H_
+#define BRIDGE_FOUNDATION_STRING_BUILDER_H_
+
+#include <quickjs/quickjs.h>
+#include <string>
+#include "foundation/macros.h"
+#include "foundation/string_view.h"
+
+namespace webf {
+
+// Concatenate strings into a single growing buffer, and create the JS string from it at the end.
+//
+// Characters are kept in one byte while the content is pure ASCII, which is the common case for markup, and the
+// buffer is widened to UTF-16 once a non ASCII character is appended. Both layouts are the native layouts of QuickJS
+// strings, so ToQuickJS() is a plain copy without any transcoding.
+class StringBuilder {
+ public:
+  StringBuilder() = default;
+  WEBF_DISALLOW_COPY_AND_ASSIGN(StringBuilder);
+
+  void ReserveCapacity(size_t capacity);
+
+  void Append(char c) {
+    if (is_8bit_ && IsASCII(c)) {
+      buffer8_.push_back(c);
+    } else {
+      Append(static_cast<char16_t>(static_cast<unsigned char>(c)));
+    }
+  }
+  void Append(char16_t c);
+  // |characters| are Latin-1 encoded.
+  void Append(const char* characters, size_t length);
+  void Append(const char16_t* characters, size_t length);
+  void Append(const StringView& string);
+  void Append(const std::string& string) { Append(string.c_str(), string.length()); }
+
+  size_t length() const { return is_8bit_ ? buffer8_.length() : buffer16_.length(); }
+  bool Is8Bit() const { return is_8bit_; }
+
+  JSValue ToQuickJS(JSContext* ctx) const;
+
+ private:
+  void UpgradeTo16Bit();
+
+  bool is_8bit_{true};
+  std::string buffer8_;
+  std::u16string buffer16_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_FOUNDATION_STRING_BUILDER_H_
@@ -4,32 +4,69 @@
  */
 
 #include "ui_command_buffer.h"
+#include <algorithm>
 #include "core/dart_methods.h"
+#include "core/dom/document.h"
 #include "core/executing_context.h"
 #include "foundation/logging.h"
 #include "include/webf_bridge.h"
 
 namespace webf {
 
-UICommandBuffer::UICommandBuffer(ExecutingContext* context) : context_(context) {}
+namespace {
+
+uint16_t StringEncoding(bool args_01_latin1, bool args_02_latin1) {
+  return (args_01_latin1 ? kUICommandArgs01Latin1 : 0) | (args_02_latin1 ? kUICommandArgs02Latin1 : 0);
+}
+
+// Commands which only create, clone or dispose detached objects, or change event listeners, do not change layout.
+bool AffectsLayout(int32_t type) {
+  switch (static_cast<UICommand>(type)) {
+    case UICommand::kCreateElement:
+    case UICommand::kCreateTextNode:
+    case UICommand::kCreateComment:
+    case UICommand::kCreateDocument:
+    case UICommand::kCreateWindow:
+    case UICommand::kCreateDocumentFragment:
+    case UICommand::kCreatePerformance:
+    case UICommand::kCloneNode:
+    case UICommand::kDisposeEventTarget:
+    case UICommand::kAddEvent:
+    case UICommand::kRemoveEvent:
+      return false;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+UICommandBuffer::UICommandBuffer(ExecutingContext* context) : context_(context) {
+  front_buffer_.reserve(UI_COMMAND_BUFFER_INITIAL_CAPACITY);
+  back_buffer_.reserve(UI_COMMAND_BUFFER_INITIAL_CAPACITY);
+}
 
 UICommandBuffer::~UICommandBuffer() {
 #if FLUTTER_BACKEND
-  // Flush and execute all disposeEventTarget commands when context released.
-  if (context_->dartMethodPtr()->flushUICommand != nullptr && !isDartHotRestart()) {
+  // Flush and execute all disposeEventTarget commands when context released. Dart side never knew a pooled page which
+  // was not handed out.
+  if (context_->dartMethodPtr()->flushUICommand != nullptr && context_->IsBoundToContextId() && !isDartHotRestart()) {
     context_->dartMethodPtr()->flushUICommand(context_->contextId());
   }
 #endif
 }
 
 void UICommandBuffer::addCommand(int32_t id, UICommand type, void* nativePtr) {
+  PrepareForCommand();
   UICommandItem item{id, static_cast<int32_t>(type), nativePtr};
   addCommand(item);
 }
 
 void UICommandBuffer::addCommand(int32_t id, UICommand type, std::unique_ptr<NativeString>&& args_01, void* nativePtr) {
   assert(args_01 != nullptr);
-  UICommandItem item{id, static_cast<int32_t>(type), args_01.release(), nativePtr};
+  PrepareForCommand();
+  const uint16_t* string_01 = back_strings_.Append(args_01->string(), args_01->length());
+  UICommandItem item{id, static_cast<int32_t>(type), string_01, args_01->length(), nullptr, 0, nativePtr};
   addCommand(item);
 }
 
@@ -40,52 +77,224 @@ void UICommandBuffer::addCommand(int32_t id,
                                  void* nativePtr) {
   assert(args_01 != nullptr);
   assert(args_02 != nullptr);
-  UICommandItem item{id, static_cast<int32_t>(type), args_01.release(), args_02.release(), nativePtr};
+  PrepareForCommand();
+  const uint16_t* string_01 = back_strings_.Append(args_01->string(), args_01->length());
+  const uint16_t* string_02 = back_strings_.Append(args_02->string(), args_02->length());
+  UICommandItem item{id, static_cast<int32_t>(type), string_01, args_01->length(),
+                     string_02, args_02->length(), nativePtr};
   addCommand(item);
 }
 
-void UICommandBuffer::addCommand(const UICommandItem& item) {
-  if (size_ >= MAXIMUM_UI_COMMAND_SIZE) {
+void UICommandBuffer::addCommand(int32_t id, UICommand type, const AtomicString& args_01, void* nativePtr) {
+  PrepareForCommand();
+  uint32_t length_01;
+  bool latin1_01;
+  const void* string_01 = AppendString(args_01, &length_01, &latin1_01);
+  uint16_t encoding = StringEncoding(latin1_01, false);
+  UICommandItem item{id, static_cast<int32_t>(type), string_01, length_01, nullptr, 0, nativePtr, encoding};
+  addCommand(item);
+}
+
+void UICommandBuffer::addCommand(int32_t id,
+                                 UICommand type,
+                                 const AtomicString& args_01,
+                                 const AtomicString& args_02,
+                                 void* nativePtr) {
+  PrepareForCommand();
+  uint32_t length_01, length_02;
+  bool latin1_01, latin1_02;
+  const void* string_01 = AppendString(args_01, &length_01, &latin1_01);
+  const void* string_02 = AppendString(args_02, &length_02, &latin1_02);
+  uint16_t encoding = StringEncoding(latin1_01, latin1_02);
+  UICommandItem item{id, static_cast<int32_t>(type), string_01, length_01, string_02, length_02, nativePtr, encoding};
+  addCommand(item);
+}
+
+void UICommandBuffer::addCommand(int32_t id, UICommand type, const std::string& args_01, void* nativePtr) {
+  PrepareForCommand();
+  uint32_t length_01;
+  bool latin1_01;
+  const void* string_01 = AppendString(args_01, &length_01, &latin1_01);
+  uint16_t encoding = StringEncoding(latin1_01, false);
+  UICommandItem item{id, static_cast<int32_t>(type), string_01, length_01, nullptr, 0, nativePtr, encoding};
+  addCommand(item);
+}
+
+void UICommandBuffer::addCommand(int32_t id,
+                                 UICommand type,
+                                 const std::string& args_01,
+                                 const AtomicString& args_02,
+                                 void* nativePtr) {
+  PrepareForCommand();
+  uint32_t length_01, length_02;
+  bool latin1_01, latin1_02;
+  const void* string_01 = AppendString(args_01, &length_01, &latin1_01);
+  const void* string_02 = AppendString(args_02, &length_02, &latin1_02);
+  uint16_t encoding = StringEncoding(latin1_01, latin1_02);
+  UICommandItem item{id, static_cast<int32_t>(type), string_01, length_01, string_02, length_02, nativePtr, encoding};
+  addCommand(item);
+}
+
+void UICommandBuffer::addCommand(int32_t id,
+                                 UICommand type,
+                                 const std::string& args_01,
+                                 const std::string& args_02,
+                                 void* nativePtr) {
+  PrepareForCommand();
+  uint32_t length_01, length_02;
+  bool latin1_01, latin1_02;
+  const void* string_01 = AppendString(args_01, &length_01, &latin1_01);
+  const void* string_02 = AppendString(args_02, &length_02, &latin1_02);
+  uint16_t encoding = StringEncoding(latin1_01, latin1_02);
+  UICommandItem item{id, static_cast<int32_t>(type), string_01, length_01, string_02, length_02, nativePtr, encoding};
+  addCommand(item);
+}
+
+const void* UICommandBuffer::AppendString(const AtomicString& string, uint32_t* length, bool* latin1) {
+  if (string.IsEmpty()) {
+    *length = 0;
+    *latin1 = latin1_payload_enabled_;
+    return back_strings_.AppendLatin1(nullptr, 0);
+  }
+
+  // Integer like strings are stored as tagged int atoms by quickjs, there are no string storage behind them.
+  if (UNLIKELY(string.Impl() & JS_ATOM_TAG_INT)) {
+    return AppendString(std::to_string(string.Impl() & JS_ATOM_MAX_INT), length, latin1);
+  }
+
+  return AppendString(string.ToStringView(), length, latin1);
+}
+
+const void* UICommandBuffer::AppendString(const std::string& string, uint32_t* length, bool* latin1) {
+  for (char c : string) {
+    if (static_cast<uint8_t>(c) > 0x7F) {
+      *latin1 = false;
+      return back_strings_.AppendUTF8(string, length);
+    }
+  }
+  // ASCII is a subset of Latin-1.
+  return AppendString(StringView(string), length, latin1);
+}
+
+const void* UICommandBuffer::AppendString(const StringView& string, uint32_t* length, bool* latin1) {
+  *length = string.length();
+  if (!string.Is8Bit()) {
+    *latin1 = false;
+    return back_strings_.Append(reinterpret_cast<const uint16_t*>(string.Characters16()), string.length());
+  }
+
+  *latin1 = latin1_payload_enabled_;
+  if (latin1_payload_enabled_) {
+    return back_strings_.AppendLatin1(string.Characters8(), string.length());
+  }
+  return back_strings_.Widen(string.Characters8(), string.length());
+}
+
+void UICommandBuffer::PrepareForCommand() {
+  // Must be called before any string argument is written to the arena, flushing releases the pending strings.
+  if (UNLIKELY(static_cast<int64_t>(back_buffer_.size()) >= max_commands_ || pending_bytes_ >= max_bytes_)) {
     if (UNLIKELY(isDartHotRestart())) {
+      // Dart side is gone, drop the pending commands as well.
+      SealPendingCommands();
       clear();
     } else {
       context_->FlushUICommand();
     }
-    assert(size_ == 0);
   }
 
 #if FLUTTER_BACKEND
-  if (UNLIKELY(!update_batched_ && context_->IsContextValid() &&
-               context_->dartMethodPtr()->requestBatchUpdate != nullptr)) {
+  if (UNLIKELY(!update_batched_)) {
+    ScheduleBatchUpdate();
+  }
+#endif
+}
+
+void UICommandBuffer::ScheduleBatchUpdate() {
+#if FLUTTER_BACKEND
+  // Pages in the pool have no context id yet, their commands are scheduled once the page is bound.
+  if (!update_batched_ && context_->IsContextValid() && context_->IsBoundToContextId() &&
+      context_->dartMethodPtr()->requestBatchUpdate != nullptr) {
     context_->dartMethodPtr()->requestBatchUpdate(context_->contextId());
     update_batched_ = true;
   }
 #endif
+}
 
-  buffer_[size_] = item;
-  size_++;
+void UICommandBuffer::addCommand(const UICommandItem& item) {
+  back_buffer_.emplace_back(item);
+  pending_targets_.emplace(item.id);
+  if (AffectsLayout(item.type) && context_->document() != nullptr) {
+    context_->document()->InvalidateLayout();
+  }
+  pending_bytes_ += sizeof(UICommandItem) +
+                    item.args_01_length * (item.string_encoding & kUICommandArgs01Latin1 ? 1 : sizeof(uint16_t)) +
+                    item.args_02_length * (item.string_encoding & kUICommandArgs02Latin1 ? 1 : sizeof(uint16_t));
 }
 
 UICommandItem* UICommandBuffer::data() {
-  return buffer_;
+  SealPendingCommands();
+  return front_buffer_.data();
 }
 
 int64_t UICommandBuffer::size() {
-  return size_;
+  return front_buffer_.size();
 }
 
 bool UICommandBuffer::empty() {
-  return size_ == 0;
+  return front_buffer_.empty() && back_buffer_.empty();
 }
 
 void UICommandBuffer::clear() {
-  for (int i = 0; i < size_; i++) {
-    delete[] reinterpret_cast<const uint16_t*>(buffer_[i].string_01);
-    delete[] reinterpret_cast<const uint16_t*>(buffer_[i].string_02);
+  // Only the sealed commands have been consumed by dart side. Commands added to the back buffer in the meantime stay
+  // pending and are scheduled for the next frame.
+  size_t used = front_buffer_.size();
+  front_buffer_.clear();
+  front_strings_.Reset();
+  ShrinkIfNeeded(front_buffer_, used);
+  pending_targets_.clear();
+  for (const UICommandItem& item : back_buffer_) {
+    pending_targets_.emplace(item.id);
   }
-  size_ = 0;
-  memset(buffer_, 0, sizeof(buffer_));
   update_batched_ = false;
+  if (!back_buffer_.empty()) {
+    ScheduleBatchUpdate();
+  }
+}
+
+void UICommandBuffer::SetFlushThreshold(int64_t max_commands, int64_t max_bytes) {
+  if (max_commands > 0)
+    max_commands_ = max_commands;
+  if (max_bytes > 0)
+    max_bytes_ = max_bytes;
+}
+
+void UICommandBuffer::SealPendingCommands() {
+  if (back_buffer_.empty())
+    return;
+
+  if (coalescing_enabled_) {
+    UICommandCoalescer::Coalesce(back_buffer_, back_strings_, coalescing_stats_);
+  }
+
+  // The previous sealed buffer have not been consumed, keep the commands in order.
+  if (!front_buffer_.empty()) {
+    front_buffer_.insert(front_buffer_.end(), back_buffer_.begin(), back_buffer_.end());
+    back_buffer_.clear();
+    front_strings_.Adopt(back_strings_);
+  } else {
+    front_buffer_.swap(back_buffer_);
+    front_strings_.swap(back_strings_);
+  }
+  pending_bytes_ = 0;
+}
+
+void UICommandBuffer::ShrinkIfNeeded(std::vector<UICommandItem>& commands, size_t used) {
+  // Give back the memory allocated by a burst of commands, but keep enough room for the common case.
+  if (commands.capacity() <= UI_COMMAND_BUFFER_INITIAL_CAPACITY || used * 4 > commands.capacity())
+    return;
+  std::vector<UICommandItem> shrunk;
+  shrunk.reserve(std::max<size_t>(UI_COMMAND_BUFFER_INITIAL_CAPACITY, used * 2));
+  commands.swap(shrunk);
 }
 
 }  // namespace webf
@@ -7,8 +7,13 @@
 #define BRIDGE_FOUNDATION_UI_COMMAND_BUFFER_H_
 
 #include <cinttypes>
+#include <unordered_set>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
 #include "bindings/qjs/native_string_utils.h"
 #include "native_value.h"
+#include "ui_command_coalescer.h"
+#include "ui_command_string_arena.h"
 
 namespace webf {
 
@@ -31,29 +36,56 @@ enum class UICommand {
   kRemoveEvent,
   kCreateDocumentFragment,
   kCreatePerformance,
+  // Insert a list of nodes with the same position, args_01 is a comma separated list of node ids.
+  kInsertAdjacentNodes,
+  // Append a copy of the descendants of node args_01 to the target. args_02 is a comma separated list of the ids of
+  // the copies, in tree order of the copied nodes.
+  kCloneSubtree,
+  // Set a style property known by the code generator. args_01 is the value and nativePtr holds the CSSPropertyID,
+  // kSetStyle is left for the other properties, such as custom properties.
+  kSetStyleById,
+  // Set a list of style properties parsed from a declaration list. args_01 is a comma separated list of keys, each one
+  // is either a CSSPropertyID or the name of a property out of the table. args_02 is the values separated by U+0000.
+  kSetStyles,
 };
 
-#define MAXIMUM_UI_COMMAND_SIZE 2048
+// Initial slots reserved for each side of the double buffer.
+#define UI_COMMAND_BUFFER_INITIAL_CAPACITY 512
+// Default high-water marks. Reaching either one forces a synchronous flush in the middle of a script, in all other
+// cases the pending commands are consumed by dart side at frame boundaries.
+#define UI_COMMAND_BUFFER_DEFAULT_MAX_COMMANDS 65536
+#define UI_COMMAND_BUFFER_DEFAULT_MAX_BYTES (8 * 1024 * 1024)
+
+// Flags of UICommandItem::string_encoding. Strings are UTF-16 unless flagged as Latin-1, in which case each character
+// takes one byte. Most of tag names, attribute names and style values are stored by quickjs as 8-bit strings, passing
+// them through as Latin-1 halves the bytes copied to and decoded by dart side.
+enum UICommandStringEncoding : uint16_t {
+  kUICommandArgs01Latin1 = 1 << 0,
+  kUICommandArgs02Latin1 = 1 << 1,
+};
 
 struct UICommandItem {
   UICommandItem() = default;
-  UICommandItem(int32_t id, int32_t type, NativeString* args_01, NativeString* args_02, void* nativePtr)
-      : type(type),
-        string_01(reinterpret_cast<int64_t>((new NativeString(args_01))->string())),
-        args_01_length(args_01->length()),
-        string_02(reinterpret_cast<int64_t>((new NativeString(args_02))->string())),
-        args_02_length(args_02->length()),
-        id(id),
-        nativePtr(reinterpret_cast<int64_t>(nativePtr)){};
-  UICommandItem(int32_t id, int32_t type, NativeString* args_01, void* nativePtr)
+  UICommandItem(int32_t id,
+                int32_t type,
+                const void* args_01,
+                uint32_t args_01_length,
+                const void* args_02,
+                uint32_t args_02_length,
+                void* nativePtr,
+                uint16_t string_encoding = 0)
       : type(type),
-        string_01(reinterpret_cast<int64_t>((new NativeString(args_01))->string())),
-        args_01_length(args_01->length()),
+        string_encoding(string_encoding),
+        string_01(reinterpret_cast<int64_t>(args_01)),
+        args_01_length(args_01_length),
+        string_02(reinterpret_cast<int64_t>(args_02)),
+        args_02_length(args_02_length),
         id(id),
         nativePtr(reinterpret_cast<int64_t>(nativePtr)){};
   UICommandItem(int32_t id, int32_t type, void* nativePtr)
       : type(type), id(id), nativePtr(reinterpret_cast<int64_t>(nativePtr)){};
-  int32_t type{0};
+  int16_t type{0};
+  uint16_t string_encoding{0};
   int32_t id{0};
   int32_t args_01_length{0};
   int32_t args_02_length{0};
@@ -64,6 +96,18 @@ struct UICommandItem {
 
 bool isDartHotRestart();
 
+// UICommandBuffer records the DOM mutations produced by JavaScript and hands them over to dart side.
+//
+// Commands are stored in two growable buffers:
+//   - The back buffer, which the producer always appends to.
+//   - The front buffer, which is sealed when dart side starts to read commands and stays untouched until dart side
+//     calls clear(). Commands generated while dart side is consuming the front buffer go to the back buffer, and
+//     survive clear().
+// Sealing swaps the two buffers so neither commands nor string payloads are copied. Both buffers shrink back to their
+// initial capacity after a burst has been consumed.
+//
+// String arguments are copied into the UICommandStringArena owned by each side of the buffer, and are released
+// together with the commands of that side.
 class UICommandBuffer {
  public:
   UICommandBuffer() = delete;
@@ -76,18 +120,79 @@ class UICommandBuffer {
                   std::unique_ptr<NativeString>&& args_02,
                   void* nativePtr);
   void addCommand(int32_t id, UICommand type, std::unique_ptr<NativeString>&& args_01, void* nativePtr);
+  // Write the characters of atomic strings into the arena directly, without intermediate NativeString copies.
+  void addCommand(int32_t id, UICommand type, const AtomicString& args_01, void* nativePtr);
+  void addCommand(int32_t id,
+                  UICommand type,
+                  const AtomicString& args_01,
+                  const AtomicString& args_02,
+                  void* nativePtr);
+  // std::string arguments are UTF-8 encoded.
+  void addCommand(int32_t id, UICommand type, const std::string& args_01, void* nativePtr);
+  void addCommand(int32_t id,
+                  UICommand type,
+                  const std::string& args_01,
+                  const AtomicString& args_02,
+                  void* nativePtr);
+  void addCommand(int32_t id,
+                  UICommand type,
+                  const std::string& args_01,
+                  const std::string& args_02,
+                  void* nativePtr);
+  // Seal the pending commands and return the sealed buffer for reading.
   UICommandItem* data();
+  // Size of sealed buffer.
   int64_t size();
   bool empty();
+  // Release the sealed commands, the pending ones are kept.
   void clear();
 
+  // Configure the high-water marks which trigger a synchronous flush before the next frame.
+  void SetFlushThreshold(int64_t max_commands, int64_t max_bytes);
+  // Bytes held by the pending commands, including the string payloads.
+  int64_t PendingBytes() const { return pending_bytes_; }
+
+  // Rewrite the pending commands with UICommandCoalescer before they are sealed. Enabled by default.
+  void SetCoalescingEnabled(bool enabled) { coalescing_enabled_ = enabled; }
+  const UICommandCoalescingStats& CoalescingStats() const { return coalescing_stats_; }
+
+  // Pass 8-bit strings to dart side as Latin-1 instead of widening them to UTF-16. Enabled by default.
+  void SetLatin1PayloadEnabled(bool enabled) { latin1_payload_enabled_ = enabled; }
+
+  // Whether a command targeting |id| has not been consumed by dart side yet.
+  bool HasPendingCommands(int32_t id) const { return pending_targets_.count(id) > 0; }
+  // Synchronous binding calls which did not need to flush, because the pending commands are not observable by them.
+  void RecordAvoidedFlush() { avoided_flush_count_++; }
+  int64_t AvoidedFlushCount() const { return avoided_flush_count_; }
+
+  // Ask dart side to read the pending commands at the next frame, once per batch.
+  void ScheduleBatchUpdate();
+
  private:
+  void PrepareForCommand();
   void addCommand(const UICommandItem& item);
+  void SealPendingCommands();
+  // Copy the string to the back arena. Returns the copied characters and whether they are stored in Latin-1.
+  const void* AppendString(const AtomicString& string, uint32_t* length, bool* latin1);
+  const void* AppendString(const std::string& string, uint32_t* length, bool* latin1);
+  const void* AppendString(const StringView& string, uint32_t* length, bool* latin1);
+  static void ShrinkIfNeeded(std::vector<UICommandItem>& commands, size_t used);
 
   ExecutingContext* context_{nullptr};
-  UICommandItem buffer_[MAXIMUM_UI_COMMAND_SIZE];
+  std::vector<UICommandItem> front_buffer_;
+  std::vector<UICommandItem> back_buffer_;
+  UICommandStringArena front_strings_;
+  UICommandStringArena back_strings_;
+  int64_t pending_bytes_{0};
+  int64_t max_commands_{UI_COMMAND_BUFFER_DEFAULT_MAX_COMMANDS};
+  int64_t max_bytes_{UI_COMMAND_BUFFER_DEFAULT_MAX_BYTES};
+  UICommandCoalescingStats coalescing_stats_;
+  // Targets of the commands in both buffers.
+  std::unordered_set<int32_t> pending_targets_;
+  int64_t avoided_flush_count_{0};
+  bool coalescing_enabled_{true};
+  bool latin1_payload_enabled_{true};
   bool update_batched_{false};
-  int64_t size_{0};
 };
 
 }  // namespace webf
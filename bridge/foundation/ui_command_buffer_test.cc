@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "ui_command_buffer.h"
+#include "core/binding_object.h"
+#include "css_property_ids.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(UICommandBuffer, growWithoutFlushInScript) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  context->FlushUICommand();
+  context->uiCommandBuffer()->SetCoalescingEnabled(false);
+  const char* code =
+      "let container = document.createElement('div');"
+      "for (let i = 0; i < 3000; i ++) { container.appendChild(document.createElement('div')); }";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  context->uiCommandBuffer()->data();
+  // 3000 createElement and 3000 insertAdjacentNode commands, all kept in one batch.
+  EXPECT_GE(context->uiCommandBuffer()->size(), 6000);
+  context->uiCommandBuffer()->clear();
+  EXPECT_EQ(context->uiCommandBuffer()->empty(), true);
+}
+
+TEST(UICommandBuffer, flushAtHighWaterMark) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  context->FlushUICommand();
+  context->uiCommandBuffer()->SetFlushThreshold(100, 0);
+  const char* code =
+      "let container = document.createElement('div');"
+      "for (let i = 0; i < 1000; i ++) { container.appendChild(document.createElement('div')); }";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  context->uiCommandBuffer()->data();
+  EXPECT_LE(context->uiCommandBuffer()->size(), 100);
+}
+
+TEST(UICommandBuffer, sealedCommandsKeepOrder) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  buffer->addCommand(1, UICommand::kCreateComment, nullptr);
+  buffer->data();
+  // Commands produced while the sealed buffer is being consumed are appended to the back buffer.
+  buffer->addCommand(2, UICommand::kCreateComment, nullptr);
+  EXPECT_EQ(buffer->size(), 1);
+  UICommandItem* items = buffer->data();
+  EXPECT_EQ(buffer->size(), 2);
+  EXPECT_EQ(items[0].id, 1);
+  EXPECT_EQ(items[1].id, 2);
+  buffer->clear();
+}
+
+TEST(UICommandBuffer, commandsAddedAfterSealSurviveClear) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  buffer->addCommand(1, UICommand::kSetAttribute, AtomicString(context->ctx(), "title"),
+                     AtomicString(context->ctx(), "a"), nullptr);
+  buffer->data();
+  // Produced while dart side is consuming the sealed commands, e.g. by an event listener.
+  buffer->addCommand(2, UICommand::kSetAttribute, AtomicString(context->ctx(), "title"),
+                     AtomicString(context->ctx(), "b"), nullptr);
+  buffer->clear();
+  EXPECT_FALSE(buffer->empty());
+  EXPECT_FALSE(buffer->HasPendingCommands(1));
+  EXPECT_TRUE(buffer->HasPendingCommands(2));
+  UICommandItem* items = buffer->data();
+  ASSERT_EQ(buffer->size(), 1);
+  EXPECT_EQ(items[0].id, 2);
+  std::string value(reinterpret_cast<const char*>(items[0].string_02), items[0].args_02_length);
+  EXPECT_EQ(value, "b");
+  buffer->clear();
+  EXPECT_TRUE(buffer->empty());
+}
+
+TEST(UICommandBuffer, stringArgumentsWrittenToArena) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  buffer->SetCoalescingEnabled(false);
+  AtomicString name = AtomicString(context->ctx(), "id");
+  AtomicString number = AtomicString(context->ctx(), JS_NewInt32(context->ctx(), 1024));
+  buffer->addCommand(1, UICommand::kSetAttribute, name, number, nullptr);
+  buffer->addCommand(1, UICommand::kSetAttribute, name, AtomicString::Empty(), nullptr);
+  UICommandItem* items = buffer->data();
+  EXPECT_EQ(buffer->size(), 2);
+
+  std::string value(reinterpret_cast<const char*>(items[0].string_02), items[0].args_02_length);
+  EXPECT_EQ(value, "1024");
+  // Empty strings still have a valid pointer, dart side treat null pointer as a missing argument.
+  EXPECT_NE(items[1].string_02, 0);
+  EXPECT_EQ(items[1].args_02_length, 0);
+  buffer->clear();
+}
+
+TEST(UICommandBuffer, collapseRepeatedStyleAndAttributeWrites) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  const char* code =
+      "let div = document.createElement('div');"
+      "document.body.appendChild(div);"
+      "for (let i = 0; i < 100; i ++) { div.style.width = i + 'px'; div.setAttribute('title', 'a' + i); }";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  UICommandItem* items = buffer->data();
+  int64_t style_commands = 0;
+  for (int64_t i = 0; i < buffer->size(); i++) {
+    if (items[i].type == static_cast<int32_t>(UICommand::kSetStyleById)) {
+      style_commands++;
+      EXPECT_EQ(items[i].nativePtr, static_cast<int64_t>(CSSPropertyID::kWidth));
+      std::string value(reinterpret_cast<const char*>(items[i].string_01), items[i].args_01_length);
+      EXPECT_EQ(value, "99px");
+    }
+  }
+  EXPECT_EQ(style_commands, 1);
+  EXPECT_EQ(buffer->CoalescingStats().style_commands, 99);
+  EXPECT_EQ(buffer->CoalescingStats().attribute_commands, 99);
+  buffer->clear();
+}
+
+TEST(UICommandBuffer, dropNodesDisposedBeforeFlush) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  auto* native_binding_object = new NativeBindingObject(nullptr);
+  buffer->addCommand(100, UICommand::kCreateElement, AtomicString(context->ctx(), "div"), native_binding_object);
+  buffer->addCommand(1, UICommand::kInsertAdjacentNode, std::string("100"), AtomicString(context->ctx(), "beforeend"),
+                     nullptr);
+  buffer->addCommand(100, UICommand::kSetStyle, std::string("color"), AtomicString(context->ctx(), "red"), nullptr);
+  buffer->addCommand(100, UICommand::kRemoveNode, nullptr);
+  buffer->addCommand(100, UICommand::kDisposeEventTarget, native_binding_object);
+  buffer->addCommand(1, UICommand::kSetStyle, std::string("color"), AtomicString(context->ctx(), "red"), nullptr);
+  UICommandItem* items = buffer->data();
+  EXPECT_EQ(buffer->size(), 1);
+  EXPECT_EQ(items[0].id, 1);
+  EXPECT_EQ(buffer->CoalescingStats().node_lifetime_commands, 5);
+  buffer->clear();
+}
+
+TEST(UICommandBuffer, mergeAdjacentInsertions) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  const char* code =
+      "let container = document.createElement('div');"
+      "for (let i = 0; i < 3; i ++) { container.appendChild(document.createElement('span')); }"
+      "document.body.appendChild(container);";
+  bridge->evaluateScript(code, strlen(code), "vm://", 0);
+  UICommandItem* items = buffer->data();
+  // Appending the container to body touches the container, it is not merged.
+  int64_t merged = 0;
+  for (int64_t i = 0; i < buffer->size(); i++) {
+    if (items[i].type == static_cast<int32_t>(UICommand::kInsertAdjacentNodes)) {
+      merged++;
+    }
+  }
+  EXPECT_EQ(merged, 1);
+  EXPECT_EQ(buffer->CoalescingStats().insert_commands, 2);
+  buffer->clear();
+}
+
+TEST(UICommandBuffer, passEightBitStringsAsLatin1) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  context->FlushUICommand();
+  buffer->addCommand(1, UICommand::kSetAttribute, AtomicString(context->ctx(), "title"),
+                     AtomicString(context->ctx(), "\xe4\xbd\xa0\xe5\xa5\xbd"), nullptr);
+  UICommandItem* items = buffer->data();
+  EXPECT_EQ(items[0].string_encoding, kUICommandArgs01Latin1);
+  std::string name(reinterpret_cast<const char*>(items[0].string_01), items[0].args_01_length);
+  EXPECT_EQ(name, "title");
+  std::u16string value(reinterpret_cast<const char16_t*>(items[0].string_02), items[0].args_02_length);
+  EXPECT_EQ(value, u"\u4f60\u597d");
+  buffer->clear();
+
+  buffer->addCommand(1, UICommand::kSetAttribute, AtomicString(context->ctx(), "title"),
+                     AtomicString(context->ctx(), "a"), nullptr);
+  EXPECT_EQ(buffer->PendingBytes(), sizeof(UICommandItem) + 6);
+  context->FlushUICommand();
+
+  buffer->SetLatin1PayloadEnabled(false);
+  buffer->addCommand(1, UICommand::kSetAttribute, AtomicString(context->ctx(), "title"),
+                     AtomicString(context->ctx(), "a"), nullptr);
+  EXPECT_EQ(buffer->PendingBytes(), sizeof(UICommandItem) + 12);
+  items = buffer->data();
+  EXPECT_EQ(items[0].string_encoding, 0);
+  buffer->clear();
+}
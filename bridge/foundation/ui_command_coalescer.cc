@@ -0,0 +1,326 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "ui_command_coalescer.h"
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "core/binding_object.h"
+#include "ui_command_buffer.h"
+
+namespace webf {
+
+namespace {
+
+// A string argument of a command, either in UTF-16 or in Latin-1.
+struct Argument {
+  const void* characters;
+  uint32_t length;
+  bool latin1;
+
+  uint16_t operator[](uint32_t index) const {
+    return latin1 ? static_cast<const uint8_t*>(characters)[index] : static_cast<const uint16_t*>(characters)[index];
+  }
+
+  bool operator==(const Argument& other) const {
+    if (length != other.length)
+      return false;
+    if (latin1 == other.latin1)
+      return length == 0 || memcmp(characters, other.characters, latin1 ? length : length * sizeof(uint16_t)) == 0;
+    for (uint32_t i = 0; i < length; i++) {
+      if ((*this)[i] != other[i])
+        return false;
+    }
+    return true;
+  }
+};
+
+Argument Argument01(const UICommandItem& command) {
+  return Argument{reinterpret_cast<const void*>(command.string_01), static_cast<uint32_t>(command.args_01_length),
+                  (command.string_encoding & kUICommandArgs01Latin1) != 0};
+}
+
+Argument Argument02(const UICommandItem& command) {
+  return Argument{reinterpret_cast<const void*>(command.string_02), static_cast<uint32_t>(command.args_02_length),
+                  (command.string_encoding & kUICommandArgs02Latin1) != 0};
+}
+
+bool IsCommand(const UICommandItem& command, UICommand type) {
+  return command.type == static_cast<int32_t>(type);
+}
+
+bool IsNodeCreation(const UICommandItem& command) {
+  return IsCommand(command, UICommand::kCreateElement) || IsCommand(command, UICommand::kCreateTextNode) ||
+         IsCommand(command, UICommand::kCreateComment) || IsCommand(command, UICommand::kCreateDocumentFragment);
+}
+
+// kInsertAdjacentNode, kCloneNode and kCloneSubtree carry the id of the other node in args_01.
+bool HasRelatedNode(const UICommandItem& command) {
+  return IsCommand(command, UICommand::kInsertAdjacentNode) || IsCommand(command, UICommand::kCloneNode) ||
+         IsCommand(command, UICommand::kCloneSubtree);
+}
+
+int32_t RelatedNodeId(const UICommandItem& command) {
+  Argument string = Argument01(command);
+  int32_t id = 0;
+  for (uint32_t i = 0; i < string.length; i++) {
+    if (string[i] < '0' || string[i] > '9')
+      return -1;
+    id = id * 10 + (string[i] - '0');
+  }
+  return id;
+}
+
+// Identify a style property or an attribute of a target. Clone commands copy the current properties of the source
+// node, so each clone starts a new epoch for the source and writes from different epochs are never collapsed.
+// Style properties set by id have an empty name.
+struct PropertyKey {
+  int32_t id;
+  int32_t epoch;
+  bool is_style;
+  int64_t property_id;
+  Argument name;
+
+  bool operator==(const PropertyKey& other) const {
+    return id == other.id && epoch == other.epoch && is_style == other.is_style &&
+           property_id == other.property_id && name == other.name;
+  }
+};
+
+struct PropertyKeyHasher {
+  std::size_t operator()(const PropertyKey& key) const {
+    std::size_t hash = std::hash<int32_t>()(key.id) ^ (std::hash<int32_t>()(key.epoch) << 1) ^ key.is_style ^
+                       (std::hash<int64_t>()(key.property_id) << 2);
+    for (uint32_t i = 0; i < key.name.length; i++) {
+      hash = hash * 31 + key.name[i];
+    }
+    return hash;
+  }
+};
+
+}  // namespace
+
+void UICommandCoalescer::Coalesce(std::vector<UICommandItem>& commands,
+                                  UICommandStringArena& strings,
+                                  UICommandCoalescingStats& stats) {
+  if (commands.size() < 2)
+    return;
+
+  std::vector<bool> eliminated(commands.size(), false);
+  DropDeadNodes(commands, eliminated, stats);
+  CollapsePropertyWrites(commands, eliminated, stats);
+  MergeInsertions(commands, eliminated, strings, stats);
+
+  size_t count = 0;
+  for (size_t i = 0; i < commands.size(); i++) {
+    if (!eliminated[i]) {
+      commands[count++] = commands[i];
+    }
+  }
+  commands.resize(count);
+}
+
+void UICommandCoalescer::CollapsePropertyWrites(std::vector<UICommandItem>& commands,
+                                                std::vector<bool>& eliminated,
+                                                UICommandCoalescingStats& stats) {
+  std::unordered_set<PropertyKey, PropertyKeyHasher> written;
+  std::unordered_map<int32_t, int32_t> epochs;
+
+  // Walk backwards, so the first write seen for a key is the one which takes effect.
+  for (size_t i = commands.size(); i-- > 0;) {
+    if (eliminated[i])
+      continue;
+    const UICommandItem& command = commands[i];
+
+    if (IsCommand(command, UICommand::kCloneNode)) {
+      epochs[command.id]++;
+      continue;
+    }
+
+    bool is_style_by_id = IsCommand(command, UICommand::kSetStyleById);
+    bool is_style = is_style_by_id || IsCommand(command, UICommand::kSetStyle);
+    if (!is_style && !IsCommand(command, UICommand::kSetAttribute) &&
+        !IsCommand(command, UICommand::kRemoveAttribute))
+      continue;
+
+    auto epoch = epochs.find(command.id);
+    PropertyKey key{command.id, epoch == epochs.end() ? 0 : epoch->second, is_style,
+                    is_style_by_id ? command.nativePtr : 0,
+                    is_style_by_id ? Argument{nullptr, 0, true} : Argument01(command)};
+    if (written.count(key) > 0) {
+      eliminated[i] = true;
+      if (is_style) {
+        stats.style_commands++;
+      } else {
+        stats.attribute_commands++;
+      }
+    } else {
+      written.emplace(key);
+    }
+  }
+}
+
+void UICommandCoalescer::DropDeadNodes(std::vector<UICommandItem>& commands,
+                                       std::vector<bool>& eliminated,
+                                       UICommandCoalescingStats& stats) {
+  std::unordered_set<int32_t> created;
+  std::unordered_set<int32_t> dead;
+  for (auto& command : commands) {
+    if (IsNodeCreation(command)) {
+      created.emplace(command.id);
+    } else if (IsCommand(command, UICommand::kDisposeEventTarget) && created.count(command.id) > 0) {
+      dead.emplace(command.id);
+    }
+  }
+
+  if (dead.empty())
+    return;
+
+  // Dart side looks up every node of a subtree copy, keep all of them.
+  for (auto& command : commands) {
+    if (!IsCommand(command, UICommand::kCloneSubtree))
+      continue;
+    dead.erase(command.id);
+    dead.erase(RelatedNodeId(command));
+    Argument ids = Argument02(command);
+    int32_t id = 0;
+    for (uint32_t i = 0; i <= ids.length; i++) {
+      if (i == ids.length || ids[i] == ',') {
+        dead.erase(id);
+        id = 0;
+      } else {
+        id = id * 10 + (ids[i] - '0');
+      }
+    }
+  }
+
+  // A dead node must still be sent when a surviving node was inserted relative to it, or cloned from it.
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (auto& command : commands) {
+      if (!HasRelatedNode(command) || dead.count(command.id) == 0)
+        continue;
+      if (dead.count(RelatedNodeId(command)) == 0) {
+        dead.erase(command.id);
+        changed = true;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < commands.size(); i++) {
+    const UICommandItem& command = commands[i];
+    bool is_dead = dead.count(command.id) > 0 || (HasRelatedNode(command) && dead.count(RelatedNodeId(command)) > 0);
+    if (!is_dead)
+      continue;
+
+    eliminated[i] = true;
+    stats.node_lifetime_commands++;
+    // Dart side frees the NativeBindingObject when it handles disposeEventTarget.
+    if (IsCommand(command, UICommand::kDisposeEventTarget) && dead.count(command.id) > 0) {
+      delete reinterpret_cast<NativeBindingObject*>(command.nativePtr);
+    }
+  }
+}
+
+void UICommandCoalescer::MergeInsertions(std::vector<UICommandItem>& commands,
+                                         std::vector<bool>& eliminated,
+                                         UICommandStringArena& strings,
+                                         UICommandCoalescingStats& stats) {
+  struct InsertGroup {
+    int32_t target;
+    Argument position;
+    std::vector<size_t> members;
+    bool open;
+  };
+
+  std::vector<InsertGroup> groups;
+  // Node id -> open groups which have this node as target or as one of the inserted nodes.
+  std::unordered_map<int32_t, std::vector<size_t>> references;
+
+  auto close_groups = [&](int32_t id, size_t keep) {
+    auto it = references.find(id);
+    if (it == references.end())
+      return;
+    bool kept = false;
+    for (size_t group : it->second) {
+      if (group == keep) {
+        kept = true;
+      } else {
+        groups[group].open = false;
+      }
+    }
+    it->second.clear();
+    if (kept)
+      it->second.emplace_back(keep);
+  };
+  auto add_reference = [&](int32_t id, size_t group) {
+    auto& list = references[id];
+    if (list.empty() || list.back() != group)
+      list.emplace_back(group);
+  };
+
+  for (size_t i = 0; i < commands.size(); i++) {
+    if (eliminated[i])
+      continue;
+    const UICommandItem& command = commands[i];
+
+    if (!IsCommand(command, UICommand::kInsertAdjacentNode)) {
+      close_groups(command.id, SIZE_MAX);
+      if (HasRelatedNode(command))
+        close_groups(RelatedNodeId(command), SIZE_MAX);
+      continue;
+    }
+
+    int32_t child = RelatedNodeId(command);
+    size_t group = SIZE_MAX;
+    auto it = references.find(command.id);
+    if (it != references.end()) {
+      for (size_t candidate : it->second) {
+        InsertGroup& insert_group = groups[candidate];
+        if (insert_group.open && insert_group.target == command.id && insert_group.position == Argument02(command)) {
+          group = candidate;
+          break;
+        }
+      }
+    }
+
+    close_groups(command.id, group);
+    close_groups(child, group);
+
+    if (group == SIZE_MAX) {
+      group = groups.size();
+      groups.emplace_back(InsertGroup{command.id, Argument02(command), {}, true});
+    }
+    groups[group].members.emplace_back(i);
+    add_reference(command.id, group);
+    add_reference(child, group);
+  }
+
+  for (auto& group : groups) {
+    if (group.members.size() < 2)
+      continue;
+
+    std::string children;
+    for (size_t member : group.members) {
+      if (!children.empty())
+        children += ',';
+      children += std::to_string(RelatedNodeId(commands[member]));
+      eliminated[member] = true;
+    }
+
+    // Emit the merged command at the place of the last insertion, all of the inserted nodes exist at that point.
+    size_t last = group.members.back();
+    const char* string_01 = strings.AppendLatin1(children.data(), children.length());
+    uint16_t encoding = kUICommandArgs01Latin1 | (group.position.latin1 ? kUICommandArgs02Latin1 : 0);
+    commands[last] = UICommandItem(group.target, static_cast<int32_t>(UICommand::kInsertAdjacentNodes), string_01,
+                                   children.length(), group.position.characters, group.position.length, nullptr,
+                                   encoding);
+    eliminated[last] = false;
+    stats.insert_commands += group.members.size() - 1;
+  }
+}
+
+}  // namespace webf
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_FOUNDATION_UI_COMMAND_COALESCER_H_
+#define BRIDGE_FOUNDATION_UI_COMMAND_COALESCER_H_
+
+#include <cinttypes>
+#include <vector>
+#include "ui_command_string_arena.h"
+
+namespace webf {
+
+struct UICommandItem;
+
+// Number of commands removed by UICommandCoalescer since the buffer was created.
+struct UICommandCoalescingStats {
+  // kSetStyle and kSetStyleById overwritten by a later write of the same property.
+  int64_t style_commands{0};
+  // kSetAttribute and kRemoveAttribute overwritten by a later write of the same attribute.
+  int64_t attribute_commands{0};
+  // Commands of nodes which were created and disposed before the flush.
+  int64_t node_lifetime_commands{0};
+  // kInsertAdjacentNode merged into a kInsertAdjacentNodes command.
+  int64_t insert_commands{0};
+
+  int64_t Total() const { return style_commands + attribute_commands + node_lifetime_commands + insert_commands; }
+};
+
+// UICommandCoalescer rewrites a batch of pending UI commands before it is handed over to dart side.
+// Only redundant work is removed, replaying the rewritten batch produces the same tree as the original batch:
+//   - Repeated style or attribute writes on the same target keep the last value only.
+//   - Nodes created and disposed within the batch are never sent to dart side, unless a surviving node depends on
+//     them (e.g. cloned from them or inserted next to them), or they take part in a subtree copy.
+//   - Insertions to the same target and position are merged into one kInsertAdjacentNodes command, as long as no
+//     command in between touches the target or the inserted nodes.
+class UICommandCoalescer {
+ public:
+  static void Coalesce(std::vector<UICommandItem>& commands,
+                       UICommandStringArena& strings,
+                       UICommandCoalescingStats& stats);
+
+ private:
+  static void CollapsePropertyWrites(std::vector<UICommandItem>& commands,
+                                     std::vector<bool>& eliminated,
+                                     UICommandCoalescingStats& stats);
+  static void DropDeadNodes(std::vector<UICommandItem>& commands,
+                            std::vector<bool>& eliminated,
+                            UICommandCoalescingStats& stats);
+  static void MergeInsertions(std::vector<UICommandItem>& commands,
+                              std::vector<bool>& eliminated,
+                              UICommandStringArena& strings,
+                              UICommandCoalescingStats& stats);
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_FOUNDATION_UI_COMMAND_COALESCER_H_
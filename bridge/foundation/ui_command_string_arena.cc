@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "ui_command_string_arena.h"
+#include <cstring>
+#include "bindings/qjs/native_string_utils.h"
+
+namespace webf {
+
+const uint16_t* UICommandStringArena::Append(const uint16_t* string, uint32_t length) {
+  auto* buffer = reinterpret_cast<uint16_t*>(Allocate(length * sizeof(uint16_t), alignof(uint16_t)));
+  if (length > 0)
+    memcpy(buffer, string, length * sizeof(uint16_t));
+  return buffer;
+}
+
+const char* UICommandStringArena::AppendLatin1(const char* string, uint32_t length) {
+  auto* buffer = reinterpret_cast<char*>(Allocate(length, 1));
+  if (length > 0)
+    memcpy(buffer, string, length);
+  return buffer;
+}
+
+const uint16_t* UICommandStringArena::Widen(const char* string, uint32_t length) {
+  auto* buffer = reinterpret_cast<uint16_t*>(Allocate(length * sizeof(uint16_t), alignof(uint16_t)));
+  auto* characters = reinterpret_cast<const uint8_t*>(string);
+  for (uint32_t i = 0; i < length; i++) {
+    buffer[i] = characters[i];
+  }
+  return buffer;
+}
+
+const uint16_t* UICommandStringArena::AppendUTF8(const std::string& string, uint32_t* length) {
+  bool is_ascii = true;
+  for (char c : string) {
+    if (static_cast<uint8_t>(c) > 0x7F) {
+      is_ascii = false;
+      break;
+    }
+  }
+
+  if (LIKELY(is_ascii)) {
+    *length = string.length();
+    return Widen(string.data(), string.length());
+  }
+
+  std::u16string utf16;
+  fromUTF8(string, utf16);
+  *length = utf16.length();
+  return Append(reinterpret_cast<const uint16_t*>(utf16.data()), utf16.length());
+}
+
+void UICommandStringArena::Adopt(UICommandStringArena& other) {
+  if (other.chunks_.empty())
+    return;
+  if (chunks_.empty()) {
+    chunks_.swap(other.chunks_);
+    return;
+  }
+  // Keep the last chunk of this arena at the end, so that it could still be used for bump allocation.
+  chunks_.insert(chunks_.end() - 1, std::make_move_iterator(other.chunks_.begin()),
+                 std::make_move_iterator(other.chunks_.end()));
+  other.chunks_.clear();
+}
+
+void UICommandStringArena::Reset() {
+  for (size_t i = 0; i < chunks_.size(); i++) {
+    if (chunks_[i].capacity == UI_COMMAND_STRING_ARENA_CHUNK_SIZE) {
+      Chunk kept = std::move(chunks_[i]);
+      kept.used = 0;
+      chunks_.clear();
+      chunks_.emplace_back(std::move(kept));
+      return;
+    }
+  }
+  chunks_.clear();
+}
+
+uint8_t* UICommandStringArena::Allocate(uint32_t bytes, uint32_t alignment) {
+  if (LIKELY(!chunks_.empty())) {
+    Chunk& current = chunks_.back();
+    uint32_t offset = (current.used + alignment - 1) & ~(alignment - 1);
+    if (offset <= current.capacity && current.capacity - offset >= bytes) {
+      current.used = offset + bytes;
+      return current.data.get() + offset;
+    }
+  }
+
+  if (UNLIKELY(bytes > UI_COMMAND_STRING_ARENA_CHUNK_SIZE)) {
+    // Oversized strings get a dedicated chunk, placed before the current chunk to keep its free space usable.
+    Chunk chunk{std::unique_ptr<uint8_t[]>(new uint8_t[bytes]), bytes, bytes};
+    uint8_t* result = chunk.data.get();
+    chunks_.insert(chunks_.empty() ? chunks_.end() : chunks_.end() - 1, std::move(chunk));
+    return result;
+  }
+
+  // Chunks allocated by new[] are aligned for any fundamental type.
+  Chunk chunk{std::unique_ptr<uint8_t[]>(new uint8_t[UI_COMMAND_STRING_ARENA_CHUNK_SIZE]),
+              UI_COMMAND_STRING_ARENA_CHUNK_SIZE, bytes};
+  uint8_t* result = chunk.data.get();
+  chunks_.emplace_back(std::move(chunk));
+  return result;
+}
+
+}  // namespace webf
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_FOUNDATION_UI_COMMAND_STRING_ARENA_H_
+#define BRIDGE_FOUNDATION_UI_COMMAND_STRING_ARENA_H_
+
+#include <cinttypes>
+#include <memory>
+#include <string>
+#include <vector>
+#include "foundation/macros.h"
+#include "foundation/string_view.h"
+
+namespace webf {
+
+// Bytes in each chunk of the arena. Strings longer than this get a dedicated chunk.
+#define UI_COMMAND_STRING_ARENA_CHUNK_SIZE (32 * 1024)
+
+// UICommandStringArena stores the payloads of UI commands, either in UTF-16 or in Latin-1 (one byte per character).
+//
+// Strings are copied into large chunks with a bump pointer, instead of allocating one heap block for every
+// argument. Chunks are never reallocated, so the returned pointers stay valid until Reset() and could be read by dart
+// side directly. All strings are released at once when the commands have been consumed.
+//
+// All Append methods return a non-null pointer, even for empty strings. Dart side treat a null pointer as a missing
+// argument.
+class UICommandStringArena {
+ public:
+  UICommandStringArena() = default;
+  WEBF_DISALLOW_COPY_AND_ASSIGN(UICommandStringArena);
+
+  const uint16_t* Append(const uint16_t* string, uint32_t length);
+  const char* AppendLatin1(const char* string, uint32_t length);
+  // Copy the 8-bit string and widen it to UTF-16.
+  const uint16_t* Widen(const char* string, uint32_t length);
+  // Decode an UTF-8 string into UTF-16.
+  const uint16_t* AppendUTF8(const std::string& string, uint32_t* length);
+
+  // Move all chunks of other to the end of this arena. Strings in other remain valid.
+  void Adopt(UICommandStringArena& other);
+  void swap(UICommandStringArena& other) { chunks_.swap(other.chunks_); }
+  // Release all strings. The first chunk is kept for the next batch.
+  void Reset();
+
+  size_t ChunkCount() const { return chunks_.size(); }
+
+ private:
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> data;
+    uint32_t capacity;
+    uint32_t used;
+  };
+
+  uint8_t* Allocate(uint32_t bytes, uint32_t alignment);
+
+  std::vector<Chunk> chunks_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_FOUNDATION_UI_COMMAND_STRING_ARENA_H_
@@ -34,11 +34,25 @@ WEBF_EXPORT_C
 void disposePage(void* page);
 WEBF_EXPORT_C
 void evaluateScripts(void* page, NativeString* code, const char* bundleFilename, int32_t startLine);
+// |code| holds |length| bytes of UTF-8 source in a buffer of |buffer_size| bytes. QuickJS needs a null character after
+// the source: the source is compiled in place when code[length] is '\0', it is copied into a terminated buffer
+// otherwise, e.g. when |buffer_size| equals |length|.
+WEBF_EXPORT_C
+void evaluateUTF8Scripts(void* page,
+                         const char* code,
+                         int32_t length,
+                         int32_t buffer_size,
+                         const char* bundleFilename,
+                         int32_t startLine);
 WEBF_EXPORT_C
 void evaluateQuickjsByteCode(void* page, uint8_t* bytes, int32_t byteLen);
 WEBF_EXPORT_C
 void parseHTML(void* page, const char* code, int32_t length);
 WEBF_EXPORT_C
+void parseHTMLInSlices(void* page, char* code, int32_t length);
+WEBF_EXPORT_C
+int8_t pumpHTMLParser(void* page, int32_t budget_us);
+WEBF_EXPORT_C
 NativeValue* invokeModuleEvent(void* page,
                                NativeString* module,
                                const char* eventType,
@@ -47,6 +61,10 @@ NativeValue* invokeModuleEvent(void* page,
 WEBF_EXPORT_C
 WebFInfo* getWebFInfo();
 WEBF_EXPORT_C
+const char* const* getBindingMethodNames(int32_t* length);
+WEBF_EXPORT_C
+const char* const* getCSSPropertyNames(int32_t* length);
+WEBF_EXPORT_C
 void dispatchUITask(void* page, void* context, void* callback);
 WEBF_EXPORT_C
 void* getUICommandItems(void* page);
@@ -55,6 +73,33 @@ int64_t getUICommandItemSize(void* page);
 WEBF_EXPORT_C
 void clearUICommandItems(void* page);
 WEBF_EXPORT_C
+void setUICommandFlushThreshold(void* page, int64_t maxCommands, int64_t maxBytes);
+WEBF_EXPORT_C
+void setUICommandCoalescingEnabled(void* page, int8_t enabled);
+WEBF_EXPORT_C
+int64_t getUICommandCoalescedCount(void* page);
+WEBF_EXPORT_C
+int64_t getUICommandAvoidedFlushCount(void* page);
+WEBF_EXPORT_C
+int64_t getAvoidedAttributeFallbackCount(void* page);
+WEBF_EXPORT_C
+void didFinishFrame(void* page);
+WEBF_EXPORT_C
+void updateViewportMetrics(void* page,
+                           double device_pixel_ratio,
+                           double inner_width,
+                           double inner_height,
+                           int64_t screen_width,
+                           int64_t screen_height,
+                           int64_t screen_avail_width,
+                           int64_t screen_avail_height);
+WEBF_EXPORT_C
+void setByteCodeCacheDirectory(const char* directory);
+WEBF_EXPORT_C
+void setPagePoolCapacity(int32_t maxPages, int64_t maxBytes);
+WEBF_EXPORT_C
+int8_t fillPagePool();
+WEBF_EXPORT_C
 void registerPluginByteCode(uint8_t* bytes, int32_t length, const char* pluginName);
 WEBF_EXPORT_C
 void registerPluginCode(const char* code, int32_t length, const char* pluginName);
@@ -19,4 +19,7 @@ declare const __webf_location_reload__: () => void;
 export const webfLocationReload = __webf_location_reload__;
 
 declare const __webf_print__: (log: string, level?: string) => void;
-export const webfPrint = __webf_print__;
\ No newline at end of file
+export const webfPrint = __webf_print__;
+
+declare const __webf_batch_read__: (targets: EventTarget[], properties: string[]) => any[];
+export const webfBatchRead = __webf_batch_read__;
\ No newline at end of file
@@ -3,7 +3,13 @@
 * Copyright (C) 2022-present The WebF authors. All rights reserved.
 */
 
-import { addWebfModuleListener, webfInvokeModule, clearWebfModuleListener, removeWebfModuleListener } from './bridge';
+import {
+  addWebfModuleListener,
+  webfInvokeModule,
+  clearWebfModuleListener,
+  removeWebfModuleListener,
+  webfBatchRead
+} from './bridge';
 import { methodChannel, triggerMethodCallHandler } from './method-channel';
 import { dispatchConnectivityChangeEvent } from "./connection";
 
@@ -15,5 +21,7 @@ export const webf = {
   invokeModule: webfInvokeModule,
   addWebfModuleListener: addWebfModuleListener,
   clearWebfModuleListener: clearWebfModuleListener,
-  removeWebfModuleListener: removeWebfModuleListener
+  removeWebfModuleListener: removeWebfModuleListener,
+  // Read properties[i] of targets[i] with a single synchronous call, e.g. to measure many elements at once.
+  batchRead: webfBatchRead
 };
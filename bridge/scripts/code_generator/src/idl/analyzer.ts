@@ -147,7 +147,8 @@ function paramsNodeToArguments(parameter: ts.ParameterDeclaration): FunctionArgu
   let typeMode = new ParameterMode();
   args.type = getParameterType(parameter.type!, typeMode);
   args.typeMode = typeMode;
-  args.required = !parameter.questionToken;
+  args.variadic = !!parameter.dotDotDotToken;
+  args.required = !parameter.questionToken && !args.variadic;
   return args;
 }
 
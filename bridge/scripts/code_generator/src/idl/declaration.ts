@@ -22,6 +22,8 @@ export class FunctionArguments {
   type: ParameterType[] = [];
   typeMode: ParameterMode;
   required: boolean;
+  // `...name: type[]`, takes the rest of the arguments.
+  variadic?: boolean;
 }
 
 export class ParameterMode {
@@ -235,7 +235,7 @@ auto* self = toScriptWrappable<${getClassName(blob)}>(JS_IsUndefined(this_val) ?
 NativeValue arguments[] = {
   ${nativeArguments.join(',\n')}
 };
-${returnValueAssignment}self->InvokeBindingMethod(binding_call_methods::k${declare.name}, ${nativeArguments.length}, arguments, exception_state);
+${returnValueAssignment}self->InvokeBindingMethod(BindingMethodId::k${declare.name}, ${nativeArguments.length}, arguments, exception_state);
 ${returnValueAssignment.length > 0 ? `return Converter<${generateIDLTypeConverter(declare.returnType)}>::ToValue(NativeValueConverter<${generateNativeValueTypeConverter(declare.returnType)}>::FromNativeValue(native_value))` : ''};
   `.trim();
 }
@@ -267,6 +267,13 @@ if (argc <= ${argsIndex + 1}) {
 }`;
 }
 
+function generateVariadicInitBody(argument: FunctionArguments, argsIndex: number) {
+  return `auto&& args_${argument.name} = Converter<${generateIDLTypeConverter(argument.type)}>::FromArguments(ctx, argc, argv, ${argsIndex}, exception_state);
+if (UNLIKELY(exception_state.HasException())) {
+  return exception_state.ToQuickJS();
+}`;
+}
+
 function generateFunctionCallBody(blob: IDLBlob, declaration: FunctionDeclaration, options: GenFunctionBodyOptions = {
   isConstructor: false,
   isInstanceMethod: false
@@ -275,6 +282,18 @@ function generateFunctionCallBody(blob: IDLBlob, declaration: FunctionDeclaratio
     return 'return JS_ThrowTypeError(ctx, "Illegal constructor");';
   }
 
+  // The variadic argument is the last one and always passed, as an empty list when it's omitted.
+  let lastArgument = declaration.args[declaration.args.length - 1];
+  if (lastArgument && lastArgument.variadic && options.isInstanceMethod && !declaration.returnTypeMode?.dartImpl) {
+    let argumentsInit = declaration.args.filter(a => a.required).map((a, i) => generateRequiredInitBody(a, i));
+    argumentsInit.push(generateVariadicInitBody(lastArgument, argumentsInit.length));
+    let returnValueAssignment = declaration.returnType[0] != FunctionArgumentType.void ? 'return_value =' : '';
+    let callArguments = [...declaration.args.map(a => `args_${a.name}`), 'exception_state'];
+    return `${argumentsInit.join('\n')}
+auto* self = toScriptWrappable<${getClassName(blob)}>(this_val);
+${returnValueAssignment} self->${generateCallMethodName(declaration.name)}(${callArguments.join(',')});`;
+  }
+
   let minimalRequiredArgc = 0;
   declaration.args.forEach(m => {
     if (m.required) minimalRequiredArgc++;
@@ -508,6 +527,10 @@ export function generateCppSource(blob: IDLBlob, options: GenerateOptions) {
           });
         }
 
+        // Prototypes are created on the first use of their class, the members are defined then.
+        let hasPrototypeMembers = options.classPropsInstallList.length > 0 || options.classMethodsInstallList.length > 0;
+        wrapperTypeRegisterList.splice(4, 0, hasPrototypeMembers ? `QJS${getClassName(blob)}::InstallPrototype` : 'nullptr');
+
         options.wrapperTypeInfoInit = `
 const WrapperTypeInfo QJS${getClassName(blob)}::wrapper_type_info_ {${wrapperTypeRegisterList.join(', ')}};
 const WrapperTypeInfo& ${getClassName(blob)}::wrapper_type_info_ = QJS${getClassName(blob)}::wrapper_type_info_;`;
@@ -25,6 +25,9 @@ export function getClassName(blob: IDLBlob) {
   if (raw.slice(0, 2) == 'ui') {
     return 'UI' + raw.slice(2);
   }
+  if (raw.slice(0, 3) == 'dom') {
+    return 'DOM' + raw.slice(3);
+  }
 
   return `${raw[0].toUpperCase() + raw.slice(1)}`;
 }
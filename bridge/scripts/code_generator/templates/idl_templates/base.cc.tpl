@@ -5,7 +5,7 @@
 
 #include "<%= blob.filename %>.h"
 #include "foundation/native_value_converter.h"
-#include "binding_call_methods.h"
+#include "binding_call_method_ids.h"
 #include "bindings/qjs/member_installer.h"
 #include "bindings/qjs/qjs_function.h"
 #include "bindings/qjs/converter_impl.h"
@@ -32,13 +32,18 @@ namespace webf {
 <% if (globalFunctionInstallList.length > 0 || classPropsInstallList.length > 0 || classMethodsInstallList.length > 0 || constructorInstallList.length > 0) { %>
 void QJS<%= className %>::Install(ExecutingContext* context) {
   <% if (globalFunctionInstallList.length > 0) { %> InstallGlobalFunctions(context); <% } %>
-  <% if(classPropsInstallList.length > 0) { %> InstallPrototypeProperties(context); <% } %>
-  <% if(classMethodsInstallList.length > 0) { %> InstallPrototypeMethods(context); <% } %>
   <% if(constructorInstallList.length > 0) { %> InstallConstructor(context); <% } %>
 }
 
 <% } %>
 
+<% if (classPropsInstallList.length > 0 || classMethodsInstallList.length > 0) { %>
+void QJS<%= className %>::InstallPrototype(ExecutingContext* context) {
+  <% if(classPropsInstallList.length > 0) { %> InstallPrototypeProperties(context); <% } %>
+  <% if(classMethodsInstallList.length > 0) { %> InstallPrototypeMethods(context); <% } %>
+}
+<% } %>
+
 <% if(globalFunctionInstallList.length > 0) { %>
 void QJS<%= className %>::InstallGlobalFunctions(ExecutingContext* context) {
   std::initializer_list<MemberInstaller::FunctionConfig> functionConfig {
@@ -74,13 +79,7 @@ void QJS<%= className %>::InstallPrototypeMethods(ExecutingContext* context) {
 
 <% if (constructorInstallList.length > 0) { %>
 void QJS<%= className %>::InstallConstructor(ExecutingContext* context) {
-  const WrapperTypeInfo* wrapperTypeInfo = GetWrapperTypeInfo();
-  JSValue constructor = context->contextData()->constructorForType(wrapperTypeInfo);
-
-  std::initializer_list<MemberInstaller::AttributeConfig> attributeConfig {
-    <%= constructorInstallList.join(',\n') %>
-  };
-  MemberInstaller::InstallAttributes(context, context->Global(), attributeConfig);
+  MemberInstaller::InstallLazyConstructor(context, GetWrapperTypeInfo());
 }
 <% } %>
 
@@ -49,6 +49,7 @@ class QJS<%= className %> : public QJSInterfaceBridge<QJS<%= className %>, <%= c
   static const WrapperTypeInfo wrapper_type_info_;
  private:
  <% if (globalFunctionInstallList.length > 0) { %> static void InstallGlobalFunctions(ExecutingContext* context); <% } %>
+ <% if (classPropsInstallList.length > 0 || classMethodsInstallList.length > 0) { %> static void InstallPrototype(ExecutingContext* context); <% } %>
  <% if (classMethodsInstallList.length > 0) { %> static void InstallPrototypeMethods(ExecutingContext* context); <% } %>
  <% if (classPropsInstallList.length > 0) { %> static void InstallPrototypeProperties(ExecutingContext* context); <% } %>
  <% if (object.construct) { %> static void InstallConstructor(ExecutingContext* context); <% } %>
@@ -0,0 +1,141 @@
+// Generated from template:
+//   code_generator/src/json/templates/make_css_property_ids.h.tpl
+// and input files:
+//   <%= template_path %>
+
+<%
+  // Each property is reachable by its camelCase name (the CSSOM attribute) and by its CSS name.
+  function cssName(name) {
+    return name.replace(/[A-Z]/g, function(c) { return '-' + c.toLowerCase(); });
+  }
+
+  // 32-bit FNV-1a with the offset basis mixed with a seed, keep it in sync with CSSPropertyNameHash().
+  function hash(name, seed) {
+    let h = (0x811c9dc5 ^ seed) >>> 0;
+    for (let i = 0; i < name.length; i++) {
+      h = Math.imul(h ^ name.charCodeAt(i), 0x01000193) >>> 0;
+    }
+    return h;
+  }
+
+  let keys = [];
+  _.forEach(data, function(name, index) {
+    keys.push({ name: name, id: index + 1 });
+    if (cssName(name) !== name) {
+      keys.push({ name: cssName(name), id: index + 1 });
+    }
+  });
+
+  // Hash and displace: keys are grouped into buckets by the unseeded hash, then each bucket, largest first, picks
+  // the first seed which moves all of its keys to empty slots.
+  let slotCount = 1;
+  while (slotCount < keys.length) slotCount <<= 1;
+  let bucketCount = slotCount >> 2;
+  let buckets = _.times(bucketCount, function(i) { return { index: i, keys: [] }; });
+  keys.forEach(function(key) { buckets[hash(key.name, 0) & (bucketCount - 1)].keys.push(key); });
+
+  let seeds = _.times(bucketCount, _.constant(0));
+  let slots = _.times(slotCount, _.constant(null));
+  _.sortBy(buckets, function(bucket) { return -bucket.keys.length; }).forEach(function(bucket) {
+    if (bucket.keys.length === 0) return;
+    for (let seed = 1; seed < 65536; seed++) {
+      let taken = bucket.keys.map(function(key) { return hash(key.name, seed) & (slotCount - 1); });
+      if (_.uniq(taken).length !== taken.length || taken.some(function(slot) { return slots[slot] !== null; })) {
+        continue;
+      }
+      taken.forEach(function(slot, i) { slots[slot] = bucket.keys[i]; });
+      seeds[bucket.index] = seed;
+      return;
+    }
+    throw new Error('Can not find a perfect hash for CSS property names.');
+  });
+%>
+
+#ifndef <%= _.snakeCase(name).toUpperCase() %>_H_
+#define <%= _.snakeCase(name).toUpperCase() %>_H_
+
+#include <cinttypes>
+#include <cstddef>
+#include <type_traits>
+
+namespace webf {
+
+// The id of a property is its index in the input file plus one, kInvalid stands for the names out of the file.
+enum class <%= options.enum_name %> : uint16_t {
+  kInvalid = 0,
+<% _.forEach(data, function(name, index) { %>
+  k<%= upperCamelCase(name) %> = <%= index + 1 %>,
+<% }) %>
+};
+
+// One past the last id.
+constexpr int32_t k<%= options.enum_name %>Count = <%= data.length + 1 %>;
+
+// The camelCase names of the properties, indexed by id.
+constexpr const char* k<%= options.enum_name %>Names[] = {
+  "",
+<% _.forEach(data, function(name) { %>
+  "<%= name %>",
+<% }) %>
+};
+
+// The CSS names of the properties, indexed by id.
+constexpr const char* k<%= options.enum_name %>CSSNames[] = {
+  "",
+<% _.forEach(data, function(name) { %>
+  "<%= cssName(name) %>",
+<% }) %>
+};
+
+struct <%= options.enum_name %>HashEntry {
+  const char* name;
+  uint8_t length;
+  <%= options.enum_name %> id;
+};
+
+constexpr uint32_t k<%= options.enum_name %>HashBucketMask = <%= bucketCount - 1 %>;
+constexpr uint32_t k<%= options.enum_name %>HashSlotMask = <%= slotCount - 1 %>;
+
+constexpr uint16_t k<%= options.enum_name %>HashSeeds[] = {
+<% _.forEach(_.chunk(seeds, 16), function(row) { %>
+  <%= row.join(', ') %>,
+<% }) %>
+};
+
+constexpr <%= options.enum_name %>HashEntry k<%= options.enum_name %>HashSlots[] = {
+<% _.forEach(slots, function(key) { %>
+  <% if (key) { %>
+  {"<%= key.name %>", <%= key.name.length %>, <%= options.enum_name %>::k<%= upperCamelCase(data[key.id - 1]) %>},
+  <% } else { %>
+  {nullptr, 0, <%= options.enum_name %>::kInvalid},
+  <% } %>
+<% }) %>
+};
+
+template <typename CharType>
+constexpr uint32_t CSSPropertyNameHash(const CharType* name, size_t length, uint32_t seed) {
+  uint32_t hash = 0x811c9dc5 ^ seed;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<std::make_unsigned_t<CharType>>(name[i])) * 0x01000193;
+  }
+  return hash;
+}
+
+// Map a camelCase or a CSS property name to its id, without any allocation.
+template <typename CharType>
+constexpr <%= options.enum_name %> <%= options.enum_name %>FromName(const CharType* name, size_t length) {
+  uint16_t seed = k<%= options.enum_name %>HashSeeds[CSSPropertyNameHash(name, length, 0) & k<%= options.enum_name %>HashBucketMask];
+  const <%= options.enum_name %>HashEntry& entry =
+      k<%= options.enum_name %>HashSlots[CSSPropertyNameHash(name, length, seed) & k<%= options.enum_name %>HashSlotMask];
+  if (entry.name == nullptr || entry.length != length)
+    return <%= options.enum_name %>::kInvalid;
+  for (size_t i = 0; i < length; i++) {
+    if (static_cast<std::make_unsigned_t<CharType>>(name[i]) != static_cast<uint8_t>(entry.name[i]))
+      return <%= options.enum_name %>::kInvalid;
+  }
+  return entry.id;
+}
+
+} // webf
+
+#endif  // <%= _.snakeCase(name).toUpperCase() %>_H_
@@ -0,0 +1,58 @@
+// Generated from template:
+//   code_generator/src/json/templates/make_ids.h.tpl
+// and input files:
+//   <%= template_path %>
+
+#ifndef <%= _.snakeCase(name).toUpperCase() %>_H_
+#define <%= _.snakeCase(name).toUpperCase() %>_H_
+
+#include <cinttypes>
+
+namespace webf {
+
+// The id of a name is its index in the input file, append new names at the end to keep the ids stable.
+enum class <%= options.enum_name %> : int32_t {
+<% _.forEach(data, function(name, index) { %>
+  <% if (_.isArray(name)) { %>
+  k<%= name[0] %> = <%= index %>,
+  <% } else if (_.isObject(name)) { %>
+  k<%= name.name %> = <%= index %>,
+  <% } else { %>
+  k<%= name %> = <%= index %>,
+  <% } %>
+<% }) %>
+};
+
+constexpr int32_t k<%= options.enum_name %>Count = <%= data.length %>;
+
+// The names of the ids, indexed by id.
+constexpr const char* k<%= options.enum_name %>Names[] = {
+<% _.forEach(data, function(name) { %>
+  <% if (_.isArray(name)) { %>
+  "<%= name[1] %>",
+  <% } else if (_.isObject(name)) { %>
+  "<%= name.name %>",
+  <% } else { %>
+  "<%= name %>",
+  <% } %>
+<% }) %>
+};
+
+// Whether the name observes layout or tree state ("layout": "read" or "write"), which may be changed by any of the
+// pending UI commands. Other names only observe the state of their own object.
+constexpr bool k<%= options.enum_name %>DependsOnLayout[] = {
+<% _.forEach(data, function(name) { %>
+  <%= !_.isArray(name) && _.isObject(name) && name.layout ? 'true' : 'false' %>,
+<% }) %>
+};
+
+// Whether calling the name may change layout at dart side ("layout": "write").
+constexpr bool k<%= options.enum_name %>ChangesLayout[] = {
+<% _.forEach(data, function(name) { %>
+  <%= !_.isArray(name) && _.isObject(name) && name.layout === 'write' ? 'true' : 'false' %>,
+<% }) %>
+};
+
+} // webf
+
+#endif  // <%= _.snakeCase(name).toUpperCase() %>_H_
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include "core/executing_context.h"
+#include "include/webf_bridge.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// Context ids index a fixed size table, the benchmarked pages reuse one id.
+static const int32_t kBenchmarkContextId = 1000;
+
+// The latency of allocateNewPage() while another page keeps the dart context and its runtime alive, as when a new tab
+// is opened.
+static void RunAllocateNewPage(benchmark::State& state) {
+  auto bridge = TEST_init();
+
+  for (auto _ : state) {
+    void* page = allocateNewPage(kBenchmarkContextId);
+    state.PauseTiming();
+    disposePage(page);
+    state.ResumeTiming();
+  }
+}
+
+static void AllocateNewPage(benchmark::State& state) {
+  RunAllocateNewPage(state);
+}
+
+// A plugin of about 256 KB source, compiled by the first page and read as bytecode by the next ones.
+static void AllocateNewPageWithPluginCode(benchmark::State& state) {
+  std::string code = "(function() {\n";
+  for (int i = 0; code.size() < 256 * 1024; i++) {
+    std::string index = std::to_string(i);
+    code += "function plugin" + index + "(a) { return a * " + index + "; }\n";
+  }
+  code += "})();\n";
+  registerPluginCode(code.c_str(), code.size(), "benchmark_plugin");
+
+  RunAllocateNewPage(state);
+
+  ExecutingContext::plugin_string_code.erase("benchmark_plugin");
+}
+
+BENCHMARK(AllocateNewPage)->Threads(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(AllocateNewPageWithPluginCode)->Threads(1)->Unit(benchmark::kMicrosecond);
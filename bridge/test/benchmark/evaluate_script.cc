@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include "bindings/qjs/native_string_utils.h"
+#include "include/webf_bridge.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// A bundle of about 2 MB, mostly declarations like a minified application bundle.
+static std::string CreateBundle() {
+  std::string code = "(function() {\n";
+  for (int i = 0; code.size() < 2 * 1024 * 1024; i++) {
+    std::string index = std::to_string(i);
+    code += "function f" + index + "(a, b) { return { value: a + b * " + index + ", name: 'f" + index + "' }; }\n";
+  }
+  code += "})();\n";
+  return code;
+}
+
+static const std::string bundle = CreateBundle();
+
+// The path of evaluateScripts: the source is a UTF-16 NativeString, converted to UTF-8 before compiling.
+static void EvaluateUTF16Bundle(benchmark::State& state) {
+  auto bridge = TEST_init();
+  std::u16string source;
+  fromUTF8(bundle, source);
+  NativeString native_string(reinterpret_cast<const uint16_t*>(source.c_str()), source.size());
+
+  for (auto _ : state) {
+    evaluateScripts(bridge.get(), reinterpret_cast<::NativeString*>(&native_string), "vm://bundle.js", 0);
+  }
+  state.SetBytesProcessed(state.iterations() * bundle.size());
+}
+
+// The path of evaluateUTF8Scripts: the UTF-8 source is compiled in place.
+static void EvaluateUTF8Bundle(benchmark::State& state) {
+  auto bridge = TEST_init();
+
+  for (auto _ : state) {
+    evaluateUTF8Scripts(bridge.get(), bundle.c_str(), bundle.size(), bundle.size() + 1, "vm://bundle.js", 0);
+  }
+  state.SetBytesProcessed(state.iterations() * bundle.size());
+}
+
+BENCHMARK(EvaluateUTF16Bundle)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(EvaluateUTF8Bundle)->Threads(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// Build 1000 connected elements with ids, then run 10k lookups interleaved with appendChild/removeChild and id
+// changes. |lookup| is the expression used to find the element of |id|.
+static std::string LookupWithMutations(const std::string& lookup) {
+  return R"(
+(() => {
+let found = 0;
+for (let i = 0; i < 10000; i ++) {
+  let id = 'item' + (i % 1000);
+  let element = )" +
+         lookup + R"(;
+  if (element) found ++;
+  if (i % 10 == 0) {
+    let container = document.getElementById('container');
+    let child = container.children[i % container.children.length];
+    container.removeChild(child);
+    container.appendChild(child);
+  }
+  if (i % 100 == 0) {
+    let element = )" +
+         lookup + R"(;
+    if (element) {
+      element.id = 'renamed';
+      element.id = id;
+    }
+  }
+}
+return found;
+})();
+)";
+}
+
+static const char* kSetupTree = R"(
+(() => {
+let container = document.createElement('div');
+container.id = 'container';
+for (let i = 0; i < 1000; i ++) {
+  let child = document.createElement('div');
+  let span = document.createElement('span');
+  span.id = 'item' + i;
+  child.appendChild(span);
+  container.appendChild(child);
+}
+document.body.appendChild(container);
+})();
+)";
+
+static void RunLookups(benchmark::State& state, const std::string& code) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  context->EvaluateJavaScript(kSetupTree, strlen(kSetupTree), "internal://", 0);
+  for (auto _ : state) {
+    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
+  }
+}
+
+static void GetElementByIdWithMutations(benchmark::State& state) {
+  RunLookups(state, LookupWithMutations("document.getElementById(id)"));
+}
+
+// Same workload resolved by walking the tree, as a baseline for the id index.
+static void QuerySelectorIdWithMutations(benchmark::State& state) {
+  RunLookups(state, LookupWithMutations("document.querySelector('#' + id)"));
+}
+
+BENCHMARK(GetElementByIdWithMutations)->Threads(1);
+BENCHMARK(QuerySelectorIdWithMutations)->Threads(1);
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+#include "foundation/dart_readable.h"
+#include "foundation/ui_command_buffer.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+static const int kCommandsPerIteration = 1000;
+
+// Counter of the ScopedAllocationCounter alive on this thread, operator new is not counted when there is none.
+static thread_local int64_t* active_new_count = nullptr;
+
+static void* CountedNew(size_t size) {
+  if (active_new_count != nullptr)
+    (*active_new_count)++;
+  void* p = std::malloc(size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+
+void* operator new(size_t size) {
+  return CountedNew(size);
+}
+
+void* operator new[](size_t size) {
+  return CountedNew(size);
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+// Counts the operator new and dart_malloc() calls made on this thread while it is alive. NativeString copies use
+// both, the string arena and the command buffers use operator new. Blocks quickjs allocates with its own allocator
+// are not counted.
+class ScopedAllocationCounter {
+ public:
+  ScopedAllocationCounter() : dart_malloc_start_(DartMallocCount()) { active_new_count = &new_count_; }
+  ~ScopedAllocationCounter() { active_new_count = nullptr; }
+
+  void Report(benchmark::State& state) const {
+    int64_t allocations = new_count_ + DartMallocCount() - dart_malloc_start_;
+    state.counters["allocs_per_command"] =
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * kCommandsPerIteration);
+  }
+
+ private:
+  int64_t new_count_{0};
+  int64_t dart_malloc_start_;
+};
+
+// The path used before UICommandStringArena: every argument is converted to a NativeString first.
+static void AddSetAttributeCommandWithNativeString(benchmark::State& state) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  AtomicString name = AtomicString(context->ctx(), "data-benchmark");
+  AtomicString value = AtomicString(context->ctx(), "some attribute value");
+  context->FlushUICommand();
+  // The commands all write the same attribute, measure them without being collapsed into one.
+  buffer->SetCoalescingEnabled(false);
+
+  ScopedAllocationCounter counter;
+  for (auto _ : state) {
+    for (int i = 0; i < kCommandsPerIteration; i++) {
+      buffer->addCommand(0, UICommand::kSetAttribute, name.ToNativeString(context->ctx()),
+                         value.ToNativeString(context->ctx()), nullptr);
+    }
+    buffer->data();
+    buffer->clear();
+  }
+  counter.Report(state);
+}
+
+static void AddSetAttributeCommandWithArena(benchmark::State& state) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  AtomicString name = AtomicString(context->ctx(), "data-benchmark");
+  AtomicString value = AtomicString(context->ctx(), "some attribute value");
+  context->FlushUICommand();
+  // The commands all write the same attribute, measure them without being collapsed into one.
+  buffer->SetCoalescingEnabled(false);
+
+  ScopedAllocationCounter counter;
+  for (auto _ : state) {
+    for (int i = 0; i < kCommandsPerIteration; i++) {
+      buffer->addCommand(0, UICommand::kSetAttribute, name, value, nullptr);
+    }
+    buffer->data();
+    buffer->clear();
+  }
+  counter.Report(state);
+}
+
+static void FlushPayload(benchmark::State& state, bool latin1) {
+  auto bridge = TEST_init();
+  auto* context = bridge->GetExecutingContext();
+  auto* buffer = context->uiCommandBuffer();
+  std::string code = R"(
+(() => {
+let container = document.createElement('div');
+for(let i = 0; i < 100; i ++) {
+  let child = document.createElement('div');
+  child.setAttribute('class', 'list-item');
+  child.style.backgroundColor = 'red';
+  child.appendChild(document.createTextNode('item ' + i));
+  container.appendChild(child);
+}
+document.body.appendChild(container);
+})();
+)";
+  context->FlushUICommand();
+  buffer->SetLatin1PayloadEnabled(latin1);
+
+  int64_t bytes = 0;
+  for (auto _ : state) {
+    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
+    bytes += buffer->PendingBytes();
+    buffer->data();
+    buffer->clear();
+  }
+  state.counters["bytes_per_flush"] = static_cast<double>(bytes) / static_cast<double>(state.iterations());
+}
+
+static void FlushPayloadUTF16(benchmark::State& state) {
+  FlushPayload(state, false);
+}
+
+static void FlushPayloadLatin1(benchmark::State& state) {
+  FlushPayload(state, true);
+}
+
+BENCHMARK(AddSetAttributeCommandWithNativeString)->Threads(1);
+BENCHMARK(AddSetAttributeCommandWithArena)->Threads(1);
+BENCHMARK(FlushPayloadUTF16)->Threads(1);
+BENCHMARK(FlushPayloadLatin1)->Threads(1);
@@ -16,15 +16,21 @@ list(APPEND WEBF_TEST_SOURCE
 list(APPEND WEBF_UNIT_TEST_SOURCEURCE
   ./test/webf_test_env.cc
   ./test/webf_test_env.h
+  ./foundation/ui_command_buffer_test.cc
   ./bindings/qjs/atomic_string_test.cc
   ./bindings/qjs/script_value_test.cc
   ./bindings/qjs/qjs_engine_patch_test.cc
+  ./bindings/qjs/byte_code_cache_test.cc
   ./core/dom/events/custom_event_test.cc
   ./core/executing_context_test.cc
+  ./core/page_pool_test.cc
+  ./core/binding_object_test.cc
   ./core/frame/console_test.cc
   ./core/frame/module_manager_test.cc
   ./core/dom/events/event_target_test.cc
   ./core/dom/document_test.cc
+  ./core/dom/selector_query_test.cc
+  ./core/dom/dom_token_list_test.cc
   ./core/dom/legacy/element_attribute_test.cc
   ./core/dom/node_test.cc
   ./core/html/legacy/html_collection_test.cc
@@ -33,6 +39,8 @@ list(APPEND WEBF_UNIT_TEST_SOURCEURCE
   ./core/frame/window_test.cc
   ./core/css/legacy/css_style_declaration_test.cc
   ./core/html/html_element_test.cc
+  ./core/html/parser/html_parser_test.cc
+  ./core/html/parser/html_fragment_cache_test.cc
   ./core/html/custom/widget_element_test.cc
   ./core/timing/performance_test.cc
 )
@@ -83,6 +91,10 @@ add_executable(webf_benchmark
   ./test/webf_test_env.cc
   ./test/webf_test_env.h
   ./test/benchmark/create_element.cc
+  ./test/benchmark/ui_command_buffer.cc
+  ./test/benchmark/get_element_by_id.cc
+  ./test/benchmark/evaluate_script.cc
+  ./test/benchmark/allocate_page.cc
 )
 target_include_directories(webf_benchmark PUBLIC
   ./third_party/googletest/googletest/include
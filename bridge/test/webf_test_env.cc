@@ -185,6 +185,8 @@ void TEST_toBlob(void* ptr,
 
 void TEST_flushUICommand(int32_t contextId) {
   auto* page = test_context_map[contextId]->page();
+  // Consume the commands the way dart side does: seal them, then release the sealed ones.
+  getUICommandItems(reinterpret_cast<void*>(page));
   clearUICommandItems(reinterpret_cast<void*>(page));
 }
 
@@ -5,10 +5,15 @@
 
 #include <atomic>
 #include <cassert>
+#include <string>
 #include <thread>
 
+#include "binding_call_method_ids.h"
+#include "bindings/qjs/byte_code_cache.h"
 #include "bindings/qjs/native_string_utils.h"
+#include "css_property_ids.h"
 #include "core/dart_context.h"
+#include "core/dom/document.h"
 #include "core/page.h"
 #include "foundation/inspector_task_queue.h"
 #include "foundation/logging.h"
@@ -62,7 +67,10 @@ void initDartContext(uint64_t* dart_methods, int32_t dart_methods_len) {
 
 void* allocateNewPage(int32_t targetContextId) {
   assert(dart_context != nullptr);
-  auto* page = new webf::WebFPage(dart_context, targetContextId, nullptr);
+  auto* page = dart_context->pagePool()->Take(targetContextId);
+  if (page == nullptr) {
+    page = new webf::WebFPage(dart_context, targetContextId, nullptr);
+  }
   dart_context->AddNewPage(page);
   return reinterpret_cast<void*>(page);
 }
@@ -80,6 +88,25 @@ void evaluateScripts(void* page_, NativeString* code, const char* bundleFilename
   page->evaluateScript(reinterpret_cast<webf::NativeString*>(code), bundleFilename, startLine);
 }
 
+void evaluateUTF8Scripts(void* page_,
+                         const char* code,
+                         int32_t length,
+                         int32_t buffer_size,
+                         const char* bundleFilename,
+                         int32_t startLine) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  assert(buffer_size >= length);
+  // QuickJS reads the null character after the source as the end of input, only a terminated source is compiled in
+  // place.
+  if (buffer_size > length && code[length] == '\0') {
+    page->evaluateScript(code, length, bundleFilename, startLine);
+    return;
+  }
+  std::string terminated_code(code, length);
+  page->evaluateScript(terminated_code.c_str(), terminated_code.size(), bundleFilename, startLine);
+}
+
 void evaluateQuickjsByteCode(void* page_, uint8_t* bytes, int32_t byteLen) {
   auto page = reinterpret_cast<webf::WebFPage*>(page_);
   assert(std::this_thread::get_id() == page->currentThread());
@@ -92,6 +119,18 @@ void parseHTML(void* page_, const char* code, int32_t length) {
   page->parseHTML(code, length);
 }
 
+void parseHTMLInSlices(void* page_, char* code, int32_t length) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  page->parseHTMLInSlices(code, length);
+}
+
+int8_t pumpHTMLParser(void* page_, int32_t budget_us) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  return page->pumpHTMLParser(budget_us) ? 1 : 0;
+}
+
 NativeValue* invokeModuleEvent(void* page_,
                                NativeString* module_name,
                                const char* eventType,
@@ -118,6 +157,16 @@ WebFInfo* getWebFInfo() {
   return webfInfo;
 }
 
+const char* const* getBindingMethodNames(int32_t* length) {
+  *length = webf::kBindingMethodIdCount;
+  return webf::kBindingMethodIdNames;
+}
+
+const char* const* getCSSPropertyNames(int32_t* length) {
+  *length = webf::kCSSPropertyIDCount;
+  return webf::kCSSPropertyIDNames;
+}
+
 void dispatchUITask(void* page_, void* context, void* callback) {
   auto page = reinterpret_cast<webf::WebFPage*>(page_);
   assert(std::this_thread::get_id() == page->currentThread());
@@ -142,6 +191,73 @@ void clearUICommandItems(void* page_) {
   page->GetExecutingContext()->uiCommandBuffer()->clear();
 }
 
+void setUICommandFlushThreshold(void* page_, int64_t maxCommands, int64_t maxBytes) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  page->GetExecutingContext()->uiCommandBuffer()->SetFlushThreshold(maxCommands, maxBytes);
+}
+
+void setUICommandCoalescingEnabled(void* page_, int8_t enabled) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  page->GetExecutingContext()->uiCommandBuffer()->SetCoalescingEnabled(enabled != 0);
+}
+
+int64_t getUICommandCoalescedCount(void* page_) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  return page->GetExecutingContext()->uiCommandBuffer()->CoalescingStats().Total();
+}
+
+int64_t getUICommandAvoidedFlushCount(void* page_) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  return page->GetExecutingContext()->uiCommandBuffer()->AvoidedFlushCount();
+}
+
+int64_t getAvoidedAttributeFallbackCount(void* page_) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  return page->GetExecutingContext()->AvoidedAttributeFallbackCount();
+}
+
+void didFinishFrame(void* page_) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  if (webf::Document* document = page->GetExecutingContext()->document()) {
+    document->InvalidateLayout();
+  }
+}
+
+void updateViewportMetrics(void* page_,
+                           double device_pixel_ratio,
+                           double inner_width,
+                           double inner_height,
+                           int64_t screen_width,
+                           int64_t screen_height,
+                           int64_t screen_avail_width,
+                           int64_t screen_avail_height) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  page->GetExecutingContext()->UpdateViewportMetrics(webf::NativeViewportMetrics{
+      device_pixel_ratio, inner_width, inner_height, screen_width, screen_height, screen_avail_width,
+      screen_avail_height});
+}
+
+void setByteCodeCacheDirectory(const char* directory) {
+  webf::ByteCodeCache::SetDirectory(directory);
+}
+
+void setPagePoolCapacity(int32_t maxPages, int64_t maxBytes) {
+  assert(dart_context != nullptr);
+  dart_context->pagePool()->SetCapacity(maxPages, maxBytes);
+}
+
+int8_t fillPagePool() {
+  assert(dart_context != nullptr);
+  return dart_context->pagePool()->Fill() ? 1 : 0;
+}
+
 void registerPluginByteCode(uint8_t* bytes, int32_t length, const char* pluginName) {
   webf::ExecutingContext::plugin_byte_code[pluginName] = webf::NativeByteCode{bytes, length};
 }
@@ -21,6 +21,9 @@ enum BindingMethodCallOperations {
   GetAllPropertyNames,
   AnonymousFunctionCall,
   AsyncAnonymousFunction,
+  // The id of the method is stored in NativeValue.uint32, see invokeBindingMethodFromNativeImpl.
+  InvokeMethod,
+  GetPropertiesBatch,
 }
 
 typedef NativeAsyncAnonymousFunctionCallback = Void Function(
@@ -55,7 +58,7 @@ void _dispatchEventToNative(Event event) {
     }
 
     Pointer<NativeValue> method = malloc.allocate(sizeOf<NativeValue>());
-    toNativeValue(method, 'dispatchEvent');
+    toNativeValue(method, getBindingMethodId('dispatchEvent'));
     Pointer<NativeValue> allocatedNativeArguments = makeNativeValueArguments(bindingObject, dispatchEventArguments);
 
     Pointer<NativeValue> returnValue = malloc.allocate(sizeOf<NativeValue>());
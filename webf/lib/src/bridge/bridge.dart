@@ -4,6 +4,9 @@
  */
 
 import 'package:flutter/foundation.dart';
+import 'package:flutter/scheduler.dart';
+import 'package:path/path.dart' as path;
+import 'package:webf/foundation.dart';
 import 'package:webf/module.dart';
 import 'package:webf/launcher.dart';
 
@@ -16,6 +19,35 @@ int _contextId = 0;
 
 int newContextId() { return ++_contextId; }
 
+int _pagePoolMaxPages = 0;
+int _pagePoolMaxBytes = 0;
+bool _pagePoolFillScheduled = false;
+
+/// Keep up to [maxPages] pages initialized ahead of time, so that new [WebF] widgets skip the setup of bindings
+/// and polyfill. Plugins are evaluated when a pooled page is handed out. The pooled pages use at most [maxBytes] of
+/// JavaScript heap when it is positive.
+///
+/// Pages are built one at a time when the app is idle. The pool is disabled by default.
+void setPagePoolSize(int maxPages, {int maxBytes = 0}) {
+  _pagePoolMaxPages = maxPages;
+  _pagePoolMaxBytes = maxBytes;
+  if (!_firstView) {
+    setPagePoolCapacity(maxPages, maxBytes);
+    _schedulePagePoolFill();
+  }
+}
+
+void _schedulePagePoolFill() {
+  if (_pagePoolMaxPages <= 0 || _pagePoolFillScheduled) return;
+  _pagePoolFillScheduled = true;
+  SchedulerBinding.instance.scheduleTask(() {
+    _pagePoolFillScheduled = false;
+    if (fillPagePool()) {
+      _schedulePagePoolFill();
+    }
+  }, Priority.idle);
+}
+
 /// Init bridge
 int initBridge(WebFViewController view) {
   if (kProfileMode) {
@@ -33,10 +65,20 @@ int initBridge(WebFViewController view) {
     List<int> dartMethods = makeDartMethodsData();
     initDartContext(dartMethods);
     _firstView = false;
+
+    getWebFTemporaryPath().then((String temporaryPath) {
+      setByteCodeCacheDirectory(path.join(temporaryPath, 'ByteCodeCaches'));
+    }).catchError((error) {
+      // Scripts are compiled from the source every time without the cache.
+    });
+
+    setPagePoolCapacity(_pagePoolMaxPages, _pagePoolMaxBytes);
   }
 
   int pageId = newContextId();
   allocateNewPage(pageId);
+  // Replace the pooled page just taken, or build the first ones.
+  _schedulePagePoolFill();
 
   return pageId;
 }
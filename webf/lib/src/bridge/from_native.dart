@@ -18,6 +18,11 @@ String uint16ToString(Pointer<Uint16> pointer, int length) {
   return String.fromCharCodes(pointer.asTypedList(length));
 }
 
+// Decode Latin-1 strings, each byte is one UTF-16 code unit.
+String latin1ToString(Pointer<Uint8> pointer, int length) {
+  return String.fromCharCodes(pointer.asTypedList(length));
+}
+
 Pointer<Uint16> _stringToUint16(String string) {
   final units = string.codeUnits;
   final Pointer<Uint16> result = malloc.allocate<Uint16>(units.length * sizeOf<Uint16>());
@@ -65,6 +65,47 @@ WebFInfo getWebFInfo() {
   return _cachedInfo;
 }
 
+typedef NativeGetBindingMethodNames = Pointer<Pointer<Utf8>> Function(Pointer<Int32> length);
+typedef DartGetBindingMethodNames = Pointer<Pointer<Utf8>> Function(Pointer<Int32> length);
+
+final DartGetBindingMethodNames _getBindingMethodNames =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeGetBindingMethodNames>>('getBindingMethodNames').asFunction();
+
+List<String> _readBindingMethodNames() {
+  Pointer<Int32> length = malloc.allocate(sizeOf<Int32>());
+  Pointer<Pointer<Utf8>> names = _getBindingMethodNames(length);
+  List<String> result = List.generate(length.value, (i) => names.elementAt(i).value.toDartString(), growable: false);
+  malloc.free(length);
+  return result;
+}
+
+// Names of the methods and properties known by the code generator, indexed by their id.
+final List<String> bindingMethodNames = _readBindingMethodNames();
+final Map<String, int> _bindingMethodIds = {
+  for (int id = 0; id < bindingMethodNames.length; id++) bindingMethodNames[id]: id
+};
+
+int getBindingMethodId(String name) {
+  return _bindingMethodIds[name]!;
+}
+
+typedef NativeGetCSSPropertyNames = Pointer<Pointer<Utf8>> Function(Pointer<Int32> length);
+typedef DartGetCSSPropertyNames = Pointer<Pointer<Utf8>> Function(Pointer<Int32> length);
+
+final DartGetCSSPropertyNames _getCSSPropertyNames =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeGetCSSPropertyNames>>('getCSSPropertyNames').asFunction();
+
+List<String> _readCSSPropertyNames() {
+  Pointer<Int32> length = malloc.allocate(sizeOf<Int32>());
+  Pointer<Pointer<Utf8>> names = _getCSSPropertyNames(length);
+  List<String> result = List.generate(length.value, (i) => names.elementAt(i).value.toDartString(), growable: false);
+  malloc.free(length);
+  return result;
+}
+
+// camelCase names of the style properties known by the code generator, indexed by their id.
+final List<String> cssPropertyNames = _readCSSPropertyNames();
+
 // Register invokeEventListener
 typedef NativeInvokeEventListener = Pointer<NativeValue> Function(
     Pointer<Void>, Pointer<NativeString>, Pointer<Utf8> eventType, Pointer<Void> nativeEvent, Pointer<NativeValue>);
@@ -148,6 +189,42 @@ void evaluateScripts(int contextId, String code, {String? url, int line = 0}) {
   freeNativeString(nativeString);
 }
 
+// Register evaluateUTF8Scripts
+typedef NativeEvaluateUTF8Scripts = Void Function(
+    Pointer<Void>, Pointer<Uint8> code, Int32 length, Int32 bufferSize, Pointer<Utf8> url, Int32 startLine);
+typedef DartEvaluateUTF8Scripts = void Function(
+    Pointer<Void>, Pointer<Uint8> code, int length, int bufferSize, Pointer<Utf8> url, int startLine);
+
+final DartEvaluateUTF8Scripts _evaluateUTF8Scripts =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeEvaluateUTF8Scripts>>('evaluateUTF8Scripts').asFunction();
+
+// Evaluate UTF-8 encoded source without decoding it into a dart string, the bridge compiles the bytes in place.
+void evaluateUTF8Scripts(int contextId, Uint8List code, {String? url, int line = 0}) {
+  if (WebFController.getControllerOfJSContextId(contextId) == null) {
+    return;
+  }
+  // Assign `vm://$id` for no url (anonymous scripts).
+  if (url == null) {
+    url = 'vm://$_anonymousScriptEvaluationId';
+    _anonymousScriptEvaluationId++;
+  }
+
+  // The source is followed by a null character, which ends the input of the compiler.
+  Pointer<Uint8> nativeCode = malloc.allocate(sizeOf<Uint8>() * (code.length + 1));
+  Uint8List nativeCodeList = nativeCode.asTypedList(code.length + 1);
+  nativeCodeList.setAll(0, code);
+  nativeCodeList[code.length] = 0;
+  Pointer<Utf8> _url = url.toNativeUtf8();
+  try {
+    assert(_allocatedPages.containsKey(contextId));
+    _evaluateUTF8Scripts(_allocatedPages[contextId]!, nativeCode, code.length, code.length + 1, _url, line);
+  } catch (e, stack) {
+    print('$e\n$stack');
+  }
+  malloc.free(nativeCode);
+  malloc.free(_url);
+}
+
 typedef NativeEvaluateQuickjsByteCode = Void Function(Pointer<Void>, Pointer<Uint8> bytes, Int32 byteLen);
 typedef DartEvaluateQuickjsByteCode = void Function(Pointer<Void>, Pointer<Uint8> bytes, int byteLen);
 
@@ -180,6 +257,54 @@ void parseHTML(int contextId, String code) {
   malloc.free(nativeCode);
 }
 
+// Register parseHTMLInSlices
+typedef NativeParseHTMLInSlices = Void Function(Pointer<Void>, Pointer<Uint8> code, Int32 length);
+typedef DartParseHTMLInSlices = void Function(Pointer<Void>, Pointer<Uint8> code, int length);
+
+final DartParseHTMLInSlices _parseHTMLInSlices =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeParseHTMLInSlices>>('parseHTMLInSlices').asFunction();
+
+// Register pumpHTMLParser
+typedef NativePumpHTMLParser = Int8 Function(Pointer<Void>, Int32 budgetUs);
+typedef DartPumpHTMLParser = int Function(Pointer<Void>, int budgetUs);
+
+final DartPumpHTMLParser _pumpHTMLParser =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativePumpHTMLParser>>('pumpHTMLParser').asFunction();
+
+// Time spent on building nodes before yielding to the event loop, keeps frames responsive for large documents.
+const int _htmlParserBudgetUs = 4000;
+
+// Parse UTF-8 encoded HTML without decoding it into a dart string first. The bytes are copied once into a native
+// buffer owned by the parser, which tokenizes the whole document at once and then inserts the nodes in time slices,
+// yielding to the event loop in between.
+Future<void> parseHTMLInSlices(int contextId, Uint8List data) async {
+  if (WebFController.getControllerOfJSContextId(contextId) == null) {
+    return;
+  }
+  assert(_allocatedPages.containsKey(contextId));
+
+  // Freed by the native parser.
+  Pointer<Uint8> buffer = malloc.allocate(sizeOf<Uint8>() * (data.isNotEmpty ? data.length : 1));
+  buffer.asTypedList(data.length).setAll(0, data);
+  try {
+    _parseHTMLInSlices(_allocatedPages[contextId]!, buffer, data.length);
+  } catch (e, stack) {
+    print('$e\n$stack');
+    return;
+  }
+
+  while (true) {
+    // The page may be disposed while waiting for the next slice.
+    if (WebFController.getControllerOfJSContextId(contextId) == null || !_allocatedPages.containsKey(contextId)) {
+      return;
+    }
+    if (_pumpHTMLParser(_allocatedPages[contextId]!, _htmlParserBudgetUs) == 1) {
+      return;
+    }
+    await Future.delayed(Duration.zero);
+  }
+}
+
 // Register initJsEngine
 typedef NativeInitDartContext = Void Function(Pointer<Uint64> dartMethods, Int32 methodsLength);
 typedef DartInitDartContext = void Function(Pointer<Uint64> dartMethods, int methodsLength);
@@ -218,6 +343,27 @@ void allocateNewPage(int targetContextId) {
   _allocatedPages[targetContextId] = page;
 }
 
+typedef NativeSetPagePoolCapacity = Void Function(Int32 maxPages, Int64 maxBytes);
+typedef DartSetPagePoolCapacity = void Function(int maxPages, int maxBytes);
+
+final DartSetPagePoolCapacity _setPagePoolCapacity =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeSetPagePoolCapacity>>('setPagePoolCapacity').asFunction();
+
+void setPagePoolCapacity(int maxPages, int maxBytes) {
+  _setPagePoolCapacity(maxPages, maxBytes);
+}
+
+typedef NativeFillPagePool = Int8 Function();
+typedef DartFillPagePool = int Function();
+
+final DartFillPagePool _fillPagePool =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeFillPagePool>>('fillPagePool').asFunction();
+
+// Build one pooled page, returns whether the pool has room for more.
+bool fillPagePool() {
+  return _fillPagePool() == 1;
+}
+
 typedef NativeRegisterPluginByteCode = Void Function(Pointer<Uint8> bytes, Int32 length, Pointer<Utf8> pluginName);
 typedef DartRegisterPluginByteCode = void Function(Pointer<Uint8> bytes, int length, Pointer<Utf8> pluginName);
 
@@ -230,6 +376,20 @@ void registerPluginByteCode(Uint8List bytecode, String name) {
   _registerPluginByteCode(bytes, bytecode.length, name.toNativeUtf8());
 }
 
+typedef NativeSetByteCodeCacheDirectory = Void Function(Pointer<Utf8> directory);
+typedef DartSetByteCodeCacheDirectory = void Function(Pointer<Utf8> directory);
+
+final DartSetByteCodeCacheDirectory _setByteCodeCacheDirectory = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeSetByteCodeCacheDirectory>>('setByteCodeCacheDirectory')
+    .asFunction();
+
+// Let the bridge store the compiled bytecode of long scripts in |directory|, and evaluate them from it next time.
+void setByteCodeCacheDirectory(String directory) {
+  Pointer<Utf8> nativeDirectory = directory.toNativeUtf8();
+  _setByteCodeCacheDirectory(nativeDirectory);
+  malloc.free(nativeDirectory);
+}
+
 typedef NativeProfileModeEnabled = Int32 Function();
 typedef DartProfileModeEnabled = int Function();
 
@@ -265,6 +425,11 @@ enum UICommandType {
   cloneNode,
   removeEvent,
   createDocumentFragment,
+  createPerformance,
+  insertAdjacentNodes,
+  cloneSubtree,
+  setStyleById,
+  setStyles,
 }
 
 class UICommandItem extends Struct {
@@ -300,6 +465,102 @@ typedef DartClearUICommandItems = void Function(Pointer<Void>);
 final DartClearUICommandItems _clearUICommandItems =
     WebFDynamicLibrary.ref.lookup<NativeFunction<NativeClearUICommandItems>>('clearUICommandItems').asFunction();
 
+typedef NativeSetUICommandFlushThreshold = Void Function(Pointer<Void>, Int64 maxCommands, Int64 maxBytes);
+typedef DartSetUICommandFlushThreshold = void Function(Pointer<Void>, int maxCommands, int maxBytes);
+
+final DartSetUICommandFlushThreshold _setUICommandFlushThreshold = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeSetUICommandFlushThreshold>>('setUICommandFlushThreshold')
+    .asFunction();
+
+// Pending UI commands are flushed at frame boundaries. Reaching one of these high-water marks forces the bridge to
+// flush in the middle of a script. Non-positive values keep the current setting.
+void setUICommandFlushThreshold(int contextId, {int maxCommands = 0, int maxBytes = 0}) {
+  assert(_allocatedPages.containsKey(contextId));
+  _setUICommandFlushThreshold(_allocatedPages[contextId]!, maxCommands, maxBytes);
+}
+
+typedef NativeSetUICommandCoalescingEnabled = Void Function(Pointer<Void>, Int8 enabled);
+typedef DartSetUICommandCoalescingEnabled = void Function(Pointer<Void>, int enabled);
+
+final DartSetUICommandCoalescingEnabled _setUICommandCoalescingEnabled = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeSetUICommandCoalescingEnabled>>('setUICommandCoalescingEnabled')
+    .asFunction();
+
+// The bridge drops redundant UI commands (overwritten styles and attributes, nodes disposed before the flush) and
+// merges adjacent insertions before they reach dart side. It is enabled by default.
+void setUICommandCoalescingEnabled(int contextId, bool enabled) {
+  assert(_allocatedPages.containsKey(contextId));
+  _setUICommandCoalescingEnabled(_allocatedPages[contextId]!, enabled ? 1 : 0);
+}
+
+typedef NativeGetUICommandCoalescedCount = Int64 Function(Pointer<Void>);
+typedef DartGetUICommandCoalescedCount = int Function(Pointer<Void>);
+
+final DartGetUICommandCoalescedCount _getUICommandCoalescedCount = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeGetUICommandCoalescedCount>>('getUICommandCoalescedCount')
+    .asFunction();
+
+// Number of UI commands eliminated by the bridge since the page was created.
+int getUICommandCoalescedCount(int contextId) {
+  assert(_allocatedPages.containsKey(contextId));
+  return _getUICommandCoalescedCount(_allocatedPages[contextId]!);
+}
+
+typedef NativeGetUICommandAvoidedFlushCount = Int64 Function(Pointer<Void>);
+typedef DartGetUICommandAvoidedFlushCount = int Function(Pointer<Void>);
+
+final DartGetUICommandAvoidedFlushCount _getUICommandAvoidedFlushCount = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeGetUICommandAvoidedFlushCount>>('getUICommandAvoidedFlushCount')
+    .asFunction();
+
+// Number of synchronous calls to dart side which did not flush the pending UI commands, because they could not
+// observe them, since the page was created.
+int getUICommandAvoidedFlushCount(int contextId) {
+  assert(_allocatedPages.containsKey(contextId));
+  return _getUICommandAvoidedFlushCount(_allocatedPages[contextId]!);
+}
+
+typedef NativeGetAvoidedAttributeFallbackCount = Int64 Function(Pointer<Void>);
+typedef DartGetAvoidedAttributeFallbackCount = int Function(Pointer<Void>);
+
+final DartGetAvoidedAttributeFallbackCount _getAvoidedAttributeFallbackCount = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeGetAvoidedAttributeFallbackCount>>('getAvoidedAttributeFallbackCount')
+    .asFunction();
+
+// Number of getAttribute() calls for missing attributes which were answered by the bridge instead of calling dart
+// side, since the page was created.
+int getAvoidedAttributeFallbackCount(int contextId) {
+  assert(_allocatedPages.containsKey(contextId));
+  return _getAvoidedAttributeFallbackCount(_allocatedPages[contextId]!);
+}
+
+typedef NativeDidFinishFrame = Void Function(Pointer<Void>);
+typedef DartDidFinishFrame = void Function(Pointer<Void>);
+
+final DartDidFinishFrame _didFinishFrame =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeDidFinishFrame>>('didFinishFrame').asFunction();
+
+// Layout may change in every frame, drop the element geometry cached by the bridge.
+void didFinishFrame(int contextId) {
+  assert(_allocatedPages.containsKey(contextId));
+  _didFinishFrame(_allocatedPages[contextId]!);
+}
+
+typedef NativeUpdateViewportMetrics = Void Function(Pointer<Void>, Double, Double, Double, Int64, Int64, Int64, Int64);
+typedef DartUpdateViewportMetrics = void Function(Pointer<Void>, double, double, double, int, int, int, int);
+
+final DartUpdateViewportMetrics _updateViewportMetrics = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeUpdateViewportMetrics>>('updateViewportMetrics')
+    .asFunction();
+
+// Window and screen metrics are read by scripts from the copy in the bridge, push them whenever they change.
+void updateViewportMetrics(int contextId, double devicePixelRatio, double innerWidth, double innerHeight,
+    int screenWidth, int screenHeight, int screenAvailWidth, int screenAvailHeight) {
+  assert(_allocatedPages.containsKey(contextId));
+  _updateViewportMetrics(_allocatedPages[contextId]!, devicePixelRatio, innerWidth, innerHeight, screenWidth,
+      screenHeight, screenAvailWidth, screenAvailHeight);
+}
+
 class UICommand {
   late final UICommandType type;
   late final int id;
@@ -313,7 +574,8 @@ class UICommand {
 }
 
 // struct UICommandItem {
-//   int32_t type;             // offset: 0 ~ 0.5
+//   int16_t type;             // offset: 0 ~ 0.25
+//   uint16_t string_encoding; // offset: 0.25 ~ 0.5
 //   int32_t id;               // offset: 0.5 ~ 1
 //   int32_t args_01_length;   // offset: 1 ~ 1.5
 //   int32_t args_02_length;   // offset: 1.5 ~ 2
@@ -328,6 +590,17 @@ const int args01StringMemOffset = 2;
 const int args02StringMemOffset = 3;
 const int nativePtrMemOffset = 4;
 
+// Flags of UICommandItem.string_encoding, strings are UTF-16 unless flagged as Latin-1.
+const int args01Latin1Flag = 1 << 0;
+const int args02Latin1Flag = 1 << 1;
+
+String _readCommandString(int address, int length, bool latin1) {
+  if (latin1) {
+    return latin1ToString(Pointer<Uint8>.fromAddress(address), length);
+  }
+  return uint16ToString(Pointer<Uint16>.fromAddress(address), length);
+}
+
 final bool isEnabledLog = !kReleaseMode && Platform.environment['ENABLE_WEBF_JS_LOG'] == 'true';
 
 // We found there are performance bottleneck of reading native memory with Dart FFI API.
@@ -342,12 +615,13 @@ List<UICommand> readNativeUICommandToDart(Pointer<Uint64> nativeCommandItems, in
 
     int typeIdCombine = rawMemory[i + typeAndIdMemOffset];
 
-    // int32_t  int32_t
-    // +-------+-------+
-    // |  id   | type  |
-    // +-------+-------+
+    // int32_t  uint16_t  int16_t
+    // +-------+----------+------+
+    // |  id   | encoding | type |
+    // +-------+----------+------+
     int id = (typeIdCombine >> 32).toSigned(32);
-    int type = (typeIdCombine ^ (id << 32)).toSigned(32);
+    int type = (typeIdCombine & 0xffff).toSigned(16);
+    int encoding = (typeIdCombine >> 16) & 0xffff;
 
     command.type = UICommandType.values[type];
     command.id = id;
@@ -368,13 +642,11 @@ List<UICommand> readNativeUICommandToDart(Pointer<Uint64> nativeCommandItems, in
 
     int args01StringMemory = rawMemory[i + args01StringMemOffset];
     if (args01StringMemory != 0) {
-      Pointer<Uint16> args_01 = Pointer.fromAddress(args01StringMemory);
-      command.args.add(uint16ToString(args_01, args01Length));
+      command.args.add(_readCommandString(args01StringMemory, args01Length, (encoding & args01Latin1Flag) != 0));
 
       int args02StringMemory = rawMemory[i + args02StringMemOffset];
       if (args02StringMemory != 0) {
-        Pointer<Uint16> args_02 = Pointer.fromAddress(args02StringMemory);
-        command.args.add(uint16ToString(args_02, args02Length));
+        command.args.add(_readCommandString(args02StringMemory, args02Length, (encoding & args02Latin1Flag) != 0));
       }
     }
 
@@ -395,8 +667,10 @@ List<UICommand> readNativeUICommandToDart(Pointer<Uint64> nativeCommandItems, in
   return results;
 }
 
+// Drop all commands of the page, including the ones which have not been sealed yet.
 void clearUICommand(int contextId) {
   assert(_allocatedPages.containsKey(contextId));
+  _getUICommandItems(_allocatedPages[contextId]!);
   _clearUICommandItems(_allocatedPages[contextId]!);
 }
 
@@ -468,6 +742,13 @@ void flushUICommand(WebFViewController view) {
           String position = command.args[1];
           view.insertAdjacentNode(id, position, childId);
           break;
+        case UICommandType.insertAdjacentNodes:
+          // Merged from adjacent insertAdjacentNode commands by the bridge, replay them in order.
+          String position = command.args[1];
+          for (String childId in command.args[0].split(',')) {
+            view.insertAdjacentNode(id, position, int.parse(childId));
+          }
+          break;
         case UICommandType.removeNode:
           view.removeNode(id);
           break;
@@ -475,12 +756,33 @@ void flushUICommand(WebFViewController view) {
           int newId = int.parse(command.args[0]);
           view.cloneNode(id, newId);
           break;
+        case UICommandType.cloneSubtree:
+          int prototypeId = int.parse(command.args[0]);
+          List<int> cloneIds = command.args[1].split(',').map(int.parse).toList(growable: false);
+          view.cloneSubtree(id, prototypeId, cloneIds);
+          break;
         case UICommandType.setStyle:
           String key = command.args[0];
           String value = command.args[1];
           view.setInlineStyle(id, key, value);
           pendingStylePropertiesTargets[id] = true;
           break;
+        case UICommandType.setStyleById:
+          // The value is the only string argument, the property id is passed in the slot of nativePtr.
+          String value = command.args.isEmpty ? '' : command.args[0];
+          view.setInlineStyle(id, cssPropertyNames[nativePtr.address], value);
+          pendingStylePropertiesTargets[id] = true;
+          break;
+        case UICommandType.setStyles:
+          // Keys are property ids, or the names of the properties out of the generated table.
+          List<String> keys = command.args[0].split(',');
+          List<String> values = command.args[1].split('\u0000');
+          for (int i = 0; i < keys.length; i++) {
+            int? propertyId = int.tryParse(keys[i]);
+            view.setInlineStyle(id, propertyId != null ? cssPropertyNames[propertyId] : keys[i], values[i]);
+          }
+          pendingStylePropertiesTargets[id] = true;
+          break;
         case UICommandType.setAttribute:
           String key = command.args[0];
           String value = command.args[1];
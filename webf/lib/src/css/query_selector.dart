@@ -42,6 +42,19 @@ List<Element> querySelectorAll(Node node, String selector) {
   return results;
 }
 
+bool matches(Element element, String selector) => SelectorEvaluator().matchSelector(_parseSelectorGroup(selector), element);
+
+Element? closest(Element element, String selector) {
+  final group = _parseSelectorGroup(selector);
+  final evaluator = SelectorEvaluator();
+  Element? current = element;
+  while (current != null) {
+    if (evaluator.matchSelector(group, current)) return current;
+    current = current.parentElement;
+  }
+  return null;
+}
+
 // http://dev.w3.org/csswg/selectors-4/#grouping
 SelectorGroup? _parseSelectorGroup(String selector) {
   CSSParser parser = CSSParser(selector)..tokenizer.inSelector = true;
@@ -3,8 +3,10 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 import 'dart:collection';
+import 'dart:ffi' show Pointer, Double, DoublePointer;
 import 'package:flutter/foundation.dart';
 import 'package:flutter/rendering.dart';
+import 'package:webf/bridge.dart';
 import 'package:webf/css.dart';
 import 'package:webf/dom.dart';
 import 'package:webf/html.dart';
@@ -157,6 +159,17 @@ class Document extends Node {
     methods['getElementsByClassName'] = BindingObjectMethodSync(call: (args) => getElementsByClassName(args));
     methods['getElementsByTagName'] = BindingObjectMethodSync(call: (args) => getElementsByTagName(args));
     methods['getElementsByName'] = BindingObjectMethodSync(call: (args) => getElementsByName(args));
+    methods['getGeometryOfElements'] = BindingObjectMethodSync(call: (args) => getGeometryOfElements(args));
+  }
+
+  // Native side reads the geometry of several elements at once and caches it until layout changes.
+  // args[0] is the output buffer, the elements follow.
+  void getGeometryOfElements(List<dynamic> args) {
+    Pointer<Double> values = (args[0] as Pointer).cast<Double>();
+    for (int i = 1; i < args.length; i++) {
+      Element element = BindingBridge.getBindingObject(args[i]) as Element;
+      element.writeGeometry(values.elementAt((i - 1) * Element.geometryFieldCount));
+    }
   }
 
   dynamic querySelector(List<dynamic> args) {
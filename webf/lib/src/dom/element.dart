@@ -4,6 +4,7 @@
  */
 
 import 'dart:async';
+import 'dart:ffi' show Pointer, Double, DoublePointer;
 import 'dart:typed_data';
 import 'dart:ui';
 
@@ -304,6 +305,29 @@ abstract class Element extends Node with ElementBase, ElementEventMixin, Element
     methods['click'] = BindingObjectMethodSync(call: (_) => click());
     methods['getElementsByClassName'] = BindingObjectMethodSync(call: (args) => getElementsByClassName(args));
     methods['getElementsByTagName'] = BindingObjectMethodSync(call: (args) => getElementsByTagName(args));
+    // Selectors which are not supported by the native selector engine fallback to these methods.
+    methods['querySelectorAll'] = BindingObjectMethodSync(call: (args) => querySelectorAll(args));
+    methods['querySelector'] = BindingObjectMethodSync(call: (args) => querySelector(args));
+    methods['matches'] = BindingObjectMethodSync(call: (args) => matches(args));
+    methods['closest'] = BindingObjectMethodSync(call: (args) => closest(args));
+  }
+
+  dynamic querySelector(List<dynamic> args) {
+    if (args[0].runtimeType == String && (args[0] as String).isEmpty) return null;
+    return QuerySelector.querySelector(this, args.first);
+  }
+
+  dynamic querySelectorAll(List<dynamic> args) {
+    if (args[0].runtimeType == String && (args[0] as String).isEmpty) return [];
+    return QuerySelector.querySelectorAll(this, args.first);
+  }
+
+  bool matches(List<dynamic> args) {
+    return QuerySelector.matches(this, args.first);
+  }
+
+  dynamic closest(List<dynamic> args) {
+    return QuerySelector.closest(this, args.first);
   }
 
   dynamic getElementsByClassName(List<dynamic> args) {
@@ -1672,25 +1696,41 @@ abstract class Element extends Node with ElementBase, ElementEventMixin, Element
   // about the size of an element and its position relative to the viewport.
   // https://drafts.csswg.org/cssom-view/#dom-element-getboundingclientrect
   BoundingClientRect get boundingClientRect {
-    BoundingClientRect boundingClientRect = BoundingClientRect.zero;
-    if (isRendererAttached) {
-      flushLayout();
-      RenderBoxModel sizedBox = renderBoxModel!;
-      // Force flush layout.
-      if (!sizedBox.hasSize) {
-        sizedBox.markNeedsLayout();
-        sizedBox.owner!.flushLayout();
-      }
+    Rect? rect = _getBoundingClientRect();
+    if (rect == null) return BoundingClientRect.zero;
+    return BoundingClientRect(rect.left, rect.top, rect.width, rect.height, rect.top, rect.right, rect.bottom, rect.left);
+  }
 
-      if (sizedBox.hasSize) {
-        Offset offset = _getOffset(sizedBox, ancestor: ownerDocument.documentElement);
-        Size size = sizedBox.size;
-        boundingClientRect = BoundingClientRect(offset.dx, offset.dy, size.width, size.height, offset.dy,
-            offset.dx + size.width, offset.dy + size.height, offset.dx);
-      }
-    }
+  Rect? _getBoundingClientRect() {
+    if (!isRendererAttached) return null;
 
-    return boundingClientRect;
+    flushLayout();
+    RenderBoxModel sizedBox = renderBoxModel!;
+    // Force flush layout.
+    if (!sizedBox.hasSize) {
+      sizedBox.markNeedsLayout();
+      sizedBox.owner!.flushLayout();
+    }
+
+    if (!sizedBox.hasSize) return null;
+    Offset offset = _getOffset(sizedBox, ancestor: ownerDocument.documentElement);
+    return offset & sizedBox.size;
+  }
+
+  // Writes the geometry which native side caches until layout changes, the order must match ElementGeometryField
+  // in bridge/core/dom/element_geometry.h.
+  static const int geometryFieldCount = 16;
+  void writeGeometry(Pointer<Double> values) {
+    Rect rect = _getBoundingClientRect() ?? Rect.zero;
+    List<num> geometry = [
+      rect.left, rect.top, rect.width, rect.height,
+      offsetTop, offsetLeft, offsetWidth, offsetHeight,
+      clientTop, clientLeft, clientWidth, clientHeight,
+      scrollTop, scrollLeft, scrollWidth, scrollHeight,
+    ];
+    for (int i = 0; i < geometry.length; i++) {
+      values[i] = geometry[i].toDouble();
+    }
   }
 
   // The HTMLElement.offsetLeft read-only property returns the number of pixels that the upper left corner
@@ -26,12 +26,13 @@ Element createElement(String name, [BindingContext? context]) {
   if (creator == null) {
     print('Unexpected element "$name"');
 
-    return _UnknownElement(context);
+    return _UnknownElement(context)..syncComputedAttributesToNative(name);
   }
 
   Element element = creator(context);
   // Assign tagName, used by inspector.
   element.tagName = name;
+  element.syncComputedAttributesToNative(name);
   return element;
 }
 
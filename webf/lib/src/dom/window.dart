@@ -4,6 +4,8 @@
  */
 import 'dart:ui';
 
+import 'package:flutter/foundation.dart' show listEquals;
+
 import 'package:webf/bridge.dart';
 import 'package:webf/dom.dart';
 import 'package:webf/foundation.dart';
@@ -78,6 +80,19 @@ class Window extends EventTarget {
 
   double get innerHeight => _viewportSize.height;
 
+  List<num>? _pushedViewportMetrics;
+
+  // Push the metrics to the bridge if they changed since the last push, scripts read them without calling into dart.
+  void syncViewportMetrics() {
+    List<num> metrics = [
+      devicePixelRatio, innerWidth, innerHeight, screen.width, screen.height, screen.availWidth, screen.availHeight
+    ];
+    if (listEquals(_pushedViewportMetrics, metrics)) return;
+    _pushedViewportMetrics = metrics;
+    updateViewportMetrics(contextId!, devicePixelRatio, innerWidth, innerHeight, screen.width, screen.height,
+        screen.availWidth, screen.availHeight);
+  }
+
   Size get _viewportSize {
     RenderViewportBox? viewport = document.viewport;
     if (viewport != null && viewport.hasSize) {
@@ -59,6 +59,9 @@ abstract class BindingObject {
   // To make sure same kind of WidgetElement only sync once.
   static final Map<Type, bool> _alreadySyncWidgetElements = {};
 
+  // To make sure the computed attributes of a tag only sync once.
+  static final Set<String> _alreadySyncComputedAttributeTags = {};
+
   final BindingContext? _context;
 
   int? get contextId => _context?.contextId;
@@ -103,11 +106,35 @@ abstract class BindingObject {
     Pointer<NativeValue> returnValue = malloc.allocate(sizeOf<NativeValue>());
 
     Pointer<NativeValue> method = malloc.allocate(sizeOf<NativeValue>());
-    toNativeValue(method, 'syncPropertiesAndMethods');
+    toNativeValue(method, getBindingMethodId('syncPropertiesAndMethods'));
     f(pointer!, returnValue, method, 3, arguments);
     return fromNativeValue(returnValue) == true;
   }
 
+  // Native side reads the binding property of the same name when getAttribute() asks for an attribute it doesn't
+  // have. Tell native side which properties this kind of element has, the misses of any other attribute, such as
+  // data-* and aria-*, are then answered without calling dart.
+  void syncComputedAttributesToNative(String tagName) {
+    if (_alreadySyncComputedAttributeTags.contains(tagName)) return;
+    if (pointer == null || pointer!.ref.invokeBindingMethodFromDart == nullptr) return;
+
+    Pointer<NativeValue> arguments = malloc.allocate(sizeOf<NativeValue>());
+    toNativeValue(arguments, _properties.keys.toList(growable: false));
+
+    DartInvokeBindingMethodsFromDart f = pointer!.ref.invokeBindingMethodFromDart.asFunction();
+    Pointer<NativeValue> returnValue = malloc.allocate(sizeOf<NativeValue>());
+
+    Pointer<NativeValue> method = malloc.allocate(sizeOf<NativeValue>());
+    toNativeValue(method, getBindingMethodId('syncComputedAttributes'));
+    f(pointer!, returnValue, method, 1, arguments);
+    if (fromNativeValue(returnValue) == true) {
+      _alreadySyncComputedAttributeTags.add(tagName);
+    }
+    malloc.free(arguments);
+    malloc.free(method);
+    malloc.free(returnValue);
+  }
+
   final SplayTreeMap<String, BindingObjectProperty> _properties = SplayTreeMap();
   final SplayTreeMap<String, BindingObjectMethod> _methods = SplayTreeMap();
 
@@ -186,13 +213,19 @@ abstract class BindingObject {
   }
 }
 
+// Properties known by the code generator are sent by id, dynamic widget properties by name.
+String _bindingPropertyName(dynamic key) {
+  return key is int ? bindingMethodNames[key] : key;
+}
+
 dynamic getterBindingCall(BindingObject bindingObject, List<dynamic> args) {
   assert(args.length == 1);
 
-  BindingObjectProperty? property = bindingObject._properties[args[0]];
+  String key = _bindingPropertyName(args[0]);
+  BindingObjectProperty? property = bindingObject._properties[key];
 
   if (isEnabledLog && property != null) {
-    print('$bindingObject getBindingProperty key: ${args[0]} result: ${property.getter()}');
+    print('$bindingObject getBindingProperty key: $key result: ${property.getter()}');
   }
 
   if (property != null) {
@@ -201,14 +234,24 @@ dynamic getterBindingCall(BindingObject bindingObject, List<dynamic> args) {
   return null;
 }
 
+// Read the properties of several binding objects in one call from native side.
+// args[0] is the output buffer, followed by a target and a property key for each property.
+void getPropertiesBatchBindingCall(List<dynamic> args) {
+  Pointer<NativeValue> results = (args[0] as Pointer).cast<NativeValue>();
+  for (int i = 1; i + 1 < args.length; i += 2) {
+    BindingObject target = BindingBridge.getBindingObject(args[i]);
+    toNativeValue(results.elementAt(i ~/ 2), getterBindingCall(target, [args[i + 1]]), target);
+  }
+}
+
 dynamic setterBindingCall(BindingObject bindingObject, List<dynamic> args) {
   assert(args.length == 2);
+  String key = _bindingPropertyName(args[0]);
+  dynamic value = args[1];
   if (isEnabledLog) {
-    print('$bindingObject setBindingProperty key: ${args[0]} value: ${args[1]}');
+    print('$bindingObject setBindingProperty key: $key value: $value');
   }
 
-  String key = args[0];
-  dynamic value = args[1];
   BindingObjectProperty? property = bindingObject._properties[key];
   if (property != null && property.setter != null) {
     property.setter!(value);
@@ -264,7 +307,15 @@ void invokeBindingMethodFromNativeImpl(Pointer<NativeBindingObject> nativeBindin
   var result = null;
   try {
     // Method is binding call method operations from internal.
-    if (method is int) {
+    if (method == BindingMethodCallOperations.InvokeMethod.index) {
+      String name = bindingMethodNames[nativeMethod.ref.uint32];
+      if (isEnabledLog) {
+        print('$bindingObject invokeBindingMethod method: $name args: $values');
+      }
+      result = bindingObject._invokeBindingMethodSync(name, values);
+    } else if (method == BindingMethodCallOperations.GetPropertiesBatch.index) {
+      getPropertiesBatchBindingCall(values);
+    } else if (method is int) {
       // Get and setter ops
       result = bindingCallMethodDispatchTable[method](bindingObject, values);
     } else {
@@ -39,8 +39,7 @@ class ScriptRunner {
   static void _evaluateScriptBundle(int contextId, WebFBundle bundle, {bool async = false}) async {
     // Evaluate bundle.
     if (bundle.isJavascript) {
-      final String contentInString = await resolveStringFromData(bundle.data!, preferSync: !async);
-      evaluateScripts(contextId, contentInString, url: bundle.url);
+      evaluateUTF8Scripts(contextId, bundle.data!, url: bundle.url);
     } else if (bundle.isBytecode) {
       evaluateQuickjsByteCode(contextId, bundle.data!);
     } else {
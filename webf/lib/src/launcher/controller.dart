@@ -147,6 +147,8 @@ class WebFViewController implements WidgetsBindingObserver, ElementsBindingObser
 
   void _postFrameCallback(Duration timeStamp) {
     if (disposed) return;
+    didFinishFrame(contextId);
+    window.syncViewportMetrics();
     flushUICommand(this);
     SchedulerBinding.instance.addPostFrameCallback(_postFrameCallback);
   }
@@ -441,7 +443,42 @@ class WebFViewController implements WidgetsBindingObserver, ElementsBindingObser
   void cloneNode(int originalId, int newId) {
     EventTarget originalTarget = _getEventTargetById(originalId)!;
     EventTarget newTarget = _getEventTargetById(newId)!;
+    _copyNodeProperties(originalTarget, newTarget);
+  }
+
+  // Append copies of the descendants of the prototype node to the target. The copies were created by the bridge, their
+  // ids are listed in tree order of the prototype descendants.
+  void cloneSubtree(int targetId, int prototypeId, List<int> cloneIds) {
+    assert(_existsTarget(targetId), 'targetId: $targetId');
+    assert(_existsTarget(prototypeId), 'prototypeId: $prototypeId');
+
+    Node target = _getEventTargetById<Node>(targetId)!;
+    Node prototype = _getEventTargetById<Node>(prototypeId)!;
+    int index = 0;
+    // Prototype nodes to copy in tree order, with the copies of their parents.
+    List<Node> pendingPrototypes = prototype.childNodes.reversed.toList();
+    List<Node> pendingParents = List.filled(pendingPrototypes.length, target, growable: true);
+
+    while (pendingPrototypes.isNotEmpty) {
+      Node prototypeNode = pendingPrototypes.removeLast();
+      Node parent = pendingParents.removeLast();
+      Node node = _getEventTargetById<Node>(cloneIds[index++])!;
+      _copyNodeProperties(prototypeNode, node);
+      if (node is Element && node.inlineStyle.isNotEmpty) {
+        node.style.flushPendingProperties();
+      }
+      parent.appendChild(node);
+
+      for (Node prototypeChild in prototypeNode.childNodes.reversed) {
+        pendingPrototypes.add(prototypeChild);
+        pendingParents.add(node);
+      }
+    }
+
+    _debugDOMTreeChanged();
+  }
 
+  void _copyNodeProperties(EventTarget originalTarget, EventTarget newTarget) {
     // Current only element clone will process in dart.
     if (originalTarget is Element) {
       Element newElement = newTarget as Element;
@@ -1143,12 +1180,11 @@ class WebFController {
 
       Uint8List data = entrypoint.data!;
       if (entrypoint.isJavascript) {
-        // Prefer sync decode in loading entrypoint.
-        evaluateScripts(contextId, await resolveStringFromData(data, preferSync: true), url: url);
+        evaluateUTF8Scripts(contextId, data, url: url);
       } else if (entrypoint.isBytecode) {
         evaluateQuickjsByteCode(contextId, data);
       } else if (entrypoint.isHTML) {
-        parseHTML(contextId, await resolveStringFromData(data));
+        await parseHTMLInSlices(contextId, data);
       } else if (entrypoint.contentType.primaryType == 'text') {
         // Fallback treating text content as JavaScript.
         try {